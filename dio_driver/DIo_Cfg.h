@@ -69,5 +69,155 @@
 			  * - Unit: Bits
 			  */
 #define NUM_OF_PINS    48
+	   /**
+			  * @brief Defination of number of channel groups in Dio_LCfg.c.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: 1
+			  * - Resolution: Fixed
+			  * - Unit: Bits
+			  */
+#define DIO_CONFIGURED_GROUPS    1
+
+	   /**
+			  * @brief Pre-compile option for single channel access through the bit-band alias.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: STD_ON, STD_OFF
+			  * - Resolution: Fixed
+			  * - Unit: Bits
+			  */
+/* STD_ON: Dio_ReadChannel / Dio_WriteChannel use the IDR / ODR bit-band word of the channel,
+ * STD_OFF (default): they use the IDR shift and a single BSRR set / reset write */
+#ifndef DIO_BITBAND_ACCESS
+#define DIO_BITBAND_ACCESS       STD_OFF
+#endif
+
+	   /**
+			  * @brief Pre-compile option for the shadow output layer.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: STD_ON, STD_OFF
+			  * - Resolution: Fixed
+			  * - Unit: Bits
+			  */
+/* STD_ON: Dio_WriteChannel / Dio_WritePort / Dio_WritePortMasked / Dio_WriteChannelGroup /
+ * Dio_FlipChannel only update a RAM copy of BSRR, the pins change at Dio_ShadowCommit.
+ * The writers storing to BSRR at once are rejected at build time: Dio_WriteChannelFast and
+ * DIO_STATIC_WRITE are left out, Dio_SoftPwm.c and Dio_Pattern.c stop with #error.
+ * Dio_OutputBatchCommit stays available, it is the explicit immediate commit */
+#ifndef DIO_SHADOW_OUTPUT
+#define DIO_SHADOW_OUTPUT        STD_OFF
+#endif
+
+	   /**
+			  * @brief Defination of the tick period of the debounce service.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: 1:65535
+			  * - Resolution: Fixed
+			  * - Unit: ms
+			  */
+/* Period to start the SysTick notification Dio_DebounceTick with */
+#define DIO_DEBOUNCE_PERIOD_MS   5
+
+	   /**
+			  * @brief Defination of number of channels in Dio_ExtiChannels.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: 1:16
+			  * - Resolution: Fixed
+			  * - Unit: Bits
+			  */
+#define DIO_EXTI_CONFIGURED_CHANNELS   1
+
+	   /**
+			  * @brief Defination of number of events the EXTI event FIFO holds.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: power of 2, 2:128
+			  * - Resolution: Fixed
+			  * - Unit: Events
+			  */
+#define DIO_EXTI_FIFO_SIZE             16
+
+	   /**
+			  * @brief Defination of number of run-length entries of the capture buffer.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: 2:65535
+			  * - Resolution: Fixed
+			  * - Unit: Entries
+			  */
+#define DIO_CAPTURE_BUFFER_SIZE        128
+
+	   /**
+			  * @brief Defination of the period Dio_CaptureTick is called at.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: 1:65535
+			  * - Resolution: Fixed
+			  * - Unit: us
+			  */
+/* Time step of the VCD dump */
+#define DIO_CAPTURE_SAMPLE_PERIOD_US   1000
+
+/* Timeout of each UART transmission of Dio_CaptureDump */
+#define DIO_CAPTURE_DUMP_TIMEOUT       1000
+
+	   /**
+			  * @brief Defination of number of channels in Dio_SoftPwmChannels.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: 1:32
+			  * - Resolution: Fixed
+			  * - Unit: Channels
+			  */
+#ifndef DIO_SOFT_PWM_CONFIGURED_CHANNELS
+#define DIO_SOFT_PWM_CONFIGURED_CHANNELS   2
+#endif
+
+/* Channels of Dio_SoftPwmChannels (Dio_LCfg.c), DIO_SOFT_PWM_CONFIGURED_CHANNELS entries:
+ * indicator LEDs dimmed by the software PWM */
+#ifndef DIO_SOFT_PWM_CHANNEL_LIST
+#define DIO_SOFT_PWM_CHANNEL_LIST          C13, C14
+#endif
+
+	   /**
+			  * @brief List of the channels accessed through compile time handles.
+			  *
+			  *
+			  * @details
+			  * - Type: define
+			  * - Range: DIO_CHANNEL(NAME, Dio_ChannelType) entries
+			  * - Resolution: Fixed
+			  * - Unit: Channels
+			  *
+			  * Each entry gives the handle DIO_<NAME> used with DIO_STATIC_WRITE / DIO_STATIC_READ.
+			  */
+#define DIO_STATIC_CHANNELS(DIO_CHANNEL) \
+	DIO_CHANNEL(LED_STATUS, C13) \
+	DIO_CHANNEL(USER_BUTTON, A0)
+
+/* Channel group of the 8-bit parallel bus on PB8..PB15 */
+#define DIO_GROUP_PARALLEL_BUS   (&Dio_ChannelGroups[0])
 
 #endif
@@ -23,6 +23,56 @@
 
 /*====================================================================================*/
 
+/* A group is one run of adjoining pins of an existing port starting at its offset,
+ * a mask not matching the offset would move the level onto other pins */
+static boolean Dio_GroupValid(const Dio_ChannelGroupType *ChannelGroupIdPtr) {
+	uint32 Run;
+
+	if ((ChannelGroupIdPtr->port >= NUM_OF_PORTS)
+			|| (ChannelGroupIdPtr->offset >= 16U)) {
+		return FALSE;
+	}
+	Run = (uint32) ChannelGroupIdPtr->mask >> ChannelGroupIdPtr->offset;
+	/* lowest mask bit at the offset, no bit below it and no gap above it */
+	return (((Run & 1U) != 0U) && ((Run << ChannelGroupIdPtr->offset) == ChannelGroupIdPtr->mask)
+			&& ((Run & (Run + 1U)) == 0U)) ? TRUE : FALSE;
+}
+
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+/* Writes waiting for Dio_ShadowCommit, a port without pending write holds 0 */
+static Dio_OutputBatchType Dio_Shadow;
+
+/* Merge the BSRR value of a port into the shadow, the last write of a pin wins */
+static void Dio_ShadowWrite(uint32 Port, uint32 Bsrr) {
+	uint32 Pins = (Bsrr | (Bsrr >> 16)) & 0xFFFFU;
+	uint32 InterruptState;
+
+	ENTER_CRITICAL_SECTION(InterruptState);
+	Dio_Shadow.Bsrr[Port] = (Dio_Shadow.Bsrr[Port] & ~(Pins | (Pins << 16))) | Bsrr;
+	EXIT_CRITICAL_SECTION(InterruptState);
+}
+
+/* Toggle the level the pin Pin of a port gets at the next commit: its pending write,
+ * or its output when none is pending. Returns that new level */
+static Dio_LevelType Dio_ShadowFlip(uint32 Port, uint32 Pin) {
+	uint32 High;
+	uint32 InterruptState;
+
+	ENTER_CRITICAL_SECTION(InterruptState);
+	if ((Dio_Shadow.Bsrr[Port] & (Pin | (Pin << 16))) != 0U) {
+		High = Dio_Shadow.Bsrr[Port] & Pin;
+	} else {
+		High = GPIO_PORT(Port)->ODR & Pin;
+	}
+	Dio_Shadow.Bsrr[Port] = (Dio_Shadow.Bsrr[Port] & ~(Pin | (Pin << 16)))
+			| ((High != 0U) ? (Pin << 16) : Pin);
+	EXIT_CRITICAL_SECTION(InterruptState);
+	return (High != 0U) ? STD_LOW : STD_HIGH;
+}
+#endif
+
+/*====================================================================================*/
+
 /**
  * \section Service_Name
  * Port_Init
@@ -48,14 +98,7 @@
  * @startuml
  * start
  * 
- *  switch (Which Port?)
- *	case ()
- *	:PORTA;
- *	case ( )
- *	:PORTB;
- *	case ( )
- *	:PORTC;
- *	endswitch
+ *  :Port = ChannelId >> 4, Pin = ChannelId & 0xF;
  * :return whether the pin is HIGH or LOW;
  * 
  * end
@@ -63,24 +106,15 @@
  */
 
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId) {
-	/*checks the given pin belongs to which port*/
-	if (ChannelId >= A0 && ChannelId <= A15) {
-		/*returns the value of the channel*/
-		return ((GPIOA->IDR >> (ChannelId)) & STD_HIGH);
-	} else if (ChannelId >= B0 && ChannelId <= B15) {
-		/*  to clear the bit that we used in define port */
-		CLEAR_BIT(ChannelId, 4);
-		/*returns the value of the channel*/
-		return ((GPIOB->IDR >> (ChannelId)) & STD_HIGH);
-	} else if (ChannelId >= C0 && ChannelId <= C15) {
-		/*  to clear the bit that we used in define port */
-		CLEAR_BIT(ChannelId, 5);
+	/*the port and the pin come from the channel encoding*/
+	if ((uint32) ChannelId < NUM_OF_PINS) {
 		/*returns the value of the channel*/
-		return ((GPIOC->IDR >> (ChannelId)) & STD_HIGH);
+		return Dio_ReadChannelFast(ChannelId);
 	} else {
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID,
 		DIO_E_PARAM_INVALID_CHANNEL_ID);
 	}
+	return STD_LOW;
 }
 /**
  * \section Service_Name
@@ -110,39 +144,23 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId) {
  * start
  * 
  * 
- *  switch (Which Port?)
- *  case ( )
- *  :PORTA;
- *  case ( )
- *  :PORTB;
- *  case ( )
- *  :PORTC;
- *  endswitch
- *  if (level is low) then (yes)
- *  :write zero on the pin;
- *  else (no)
- *  :write high on the pin;
- *  endif;
+ *  :Port = ChannelId >> 4, Pin = ChannelId & 0xF;
+ *  :BSRR = (1 << Pin) << (Level is low ? 16 : 0);
  *  
  * end
  * @enduml
  */
 
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level) {
-	/*checks the given pin belongs to which port*/
-	if (ChannelId >= A0 && ChannelId <= A15)
-		Dio_SetPinValue( GPIOA, ChannelId, Level);
-	else if (ChannelId >= B0 && ChannelId <= B15) {
-		/*  to clear the bit that we used in define port */
-		CLEAR_BIT(ChannelId, 4);
-		Dio_SetPinValue( GPIOB, ChannelId, Level);
-	}
-
-	else if (ChannelId >= C0 && ChannelId <= C15) {
-		/*  to clear the bit that we used in define port */
-		CLEAR_BIT(ChannelId, 5);
-		Dio_SetPinValue( GPIOC, ChannelId, Level);
-	} else
+	/*the port and the pin come from the channel encoding*/
+	if ((uint32) ChannelId < NUM_OF_PINS)
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+		Dio_ShadowWrite(DIO_CHANNEL_PORT(ChannelId), DIO_CHANNEL_MASK(ChannelId)
+				<< ((~(uint32) Level & STD_HIGH) << 4));
+#else
+		Dio_WriteChannelFast(ChannelId, Level);
+#endif
+	else
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID,
 		DIO_E_PARAM_INVALID_CHANNEL_ID);
 }
@@ -208,6 +226,7 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId) {
 		DIO_E_PARAM_INVALID_PORT_ID);
 		break;
 	}
+	return STD_PORTLOW;
 }
 
 /**
@@ -245,29 +264,32 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId) {
  *  case ( )
  *  :PORTC;
  *  endswitch
- *  if (level is low) then (yes)
- *  :write zero on it;
- *  else (no)
- *  :write high on it;
- *  endif;
+ *  :BSRR = Level | (~Level << 16);
  * 
  *  
  * end
  * @enduml
  */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level) {
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+	if ((uint32) PortId < NUM_OF_PORTS) {
+		/*the pins change at Dio_ShadowCommit*/
+		Dio_ShadowWrite(PortId, DIO_BSRR_VALUE(Level, STD_PORTHIGH));
+		return;
+	}
+#endif
 	switch (PortId) {
 	case PORTA:
 		/*turn on/off the port given*/
-		Dio_SetPortValue( GPIOA, Level);
+		Dio_SetPortValue( GPIOA, Level, STD_PORTHIGH);
 		break;
 	case PORTB:
 		/*turn on/off the port given*/
-		Dio_SetPortValue( GPIOB, Level);
+		Dio_SetPortValue( GPIOB, Level, STD_PORTHIGH);
 		break;
 	case PORTC:
 		/*turn on/off the port given*/
-		Dio_SetPortValue( GPIOC, Level);
+		Dio_SetPortValue( GPIOC, Level, STD_PORTHIGH);
 		break;
 	default:
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORT_SID,
@@ -276,6 +298,57 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level) {
 	}
 }
 
+/**
+ * \section Service_Name
+ * Dio_WritePortMasked
+ *
+ * \section Description
+ * Function to Write the Levels of the pins of a Port selected by Mask
+ * \section Req_ID
+ * Dio_0x09
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] PortId    \Hold the PortId Id to detect it's Address
+ * \param[in] Level     \Hold the Level of the pins
+ * \param[in] Mask      \Hold the pins to change
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ * @startuml
+ * start
+ *
+ * if (PortId is valid) then (yes)
+ * :BSRR = (Level & Mask) | ((~Level & Mask) << 16);
+ * else (no)
+ * :Report Error;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_WritePortMasked(Dio_PortType PortId, Dio_PortLevelType Level,
+		Dio_PortLevelType Mask) {
+	if ((uint32) PortId < NUM_OF_PORTS) {
+		/*turn on/off the selected pins of the port given*/
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+		Dio_ShadowWrite(PortId, DIO_BSRR_VALUE(Level, Mask));
+#else
+		Dio_SetPortValue(GPIO_PORT(PortId), Level, Mask);
+#endif
+	} else {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORT_MASKED_SID,
+		DIO_E_PARAM_INVALID_PORT_ID);
+	}
+}
+
 /**
  * \section Service_Name
  * Dio_FlipChannel
@@ -304,19 +377,14 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level) {
  * start
  * 
  * 
- *  switch (Which Port?)
- *	case ( )
- *	:PORTA;
- *	case ( )
- *	:PORTB;
- *	case ( )
- *	:PORTC;
- *	endswitch
+ *  :Port = ChannelId >> 4, Pin = ChannelId & 0xF;
+ *  :read ODR once;
  *	if (pin is low) then (yes)
- *  :make it high;
+ *  :BSRR set half = 1 << Pin;
  *  else (no)
- *  :make it low;
+ *  :BSRR reset half = 1 << Pin;
  *  endif;
+ *  :return the new level;
  * 
 
  * 
@@ -324,30 +392,302 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level) {
  * @enduml
  */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId) {
-if (ChannelId >= A0 && ChannelId <= A15) {
-	/* toggling the bit that we use to turn on/off the pin*/
-	Dio_TogglePin(GPIOA, ChannelId);
-	/*retuns the level of the given pin after flipping*/
-	return (GET_BIT(GPIOA->ODR, ChannelId));
-} else if (ChannelId >= B0 && ChannelId <= B15) {
-	/*  to clear the bit that we used in define port */
-	CLEAR_BIT(ChannelId, 4);
-	/* toggling the bit that we use to turn on/off the pin*/
-	Dio_TogglePin(GPIOB, ChannelId);
+if ((uint32) ChannelId < NUM_OF_PINS) {
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+	/*the level the pin gets at the next commit is toggled*/
+	return Dio_ShadowFlip(DIO_CHANNEL_PORT(ChannelId), DIO_CHANNEL_MASK(ChannelId));
+#endif
+	/* toggling the pin with one BSRR store, safe against writers in interrupts*/
 	/*retuns the level of the given pin after flipping*/
-	return (GET_BIT(GPIOB->ODR, ChannelId));
-} else if (ChannelId >= C0 && ChannelId <= C15) {
-	/*  to clear the bit that we used in define port */
-	CLEAR_BIT(ChannelId, 5);
-	/* toggling the bit that we use to turn on/off the pin*/
-	Dio_TogglePin(GPIOC, ChannelId);
-	/*retuns the level of the given pin after flipping*/
-	return (GET_BIT(GPIOC->ODR, ChannelId));
+	return Dio_TogglePin(DIO_CHANNEL_REGS(ChannelId),
+			(Dio_ChannelType) DIO_CHANNEL_PIN(ChannelId));
 } else {
 	Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID,
 	DIO_E_PARAM_INVALID_CHANNEL_ID);
 }
+return STD_LOW;
+}
+
+/**
+ * \section Service_Name
+ * Dio_ReadChannelGroup
+ *
+ * \section Description
+ * Function to Read the Level of a group of adjoining channels of one port
+ * \section Req_ID
+ * Dio_0x07
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] ChannelGroupIdPtr \Hold the port, mask and offset of the group
+ * \param[inout] None
+ * \param[out] None
+ * \return Dio_PortLevelType
+ *
+ * @startuml
+ * start
+ *
+ * if (group is valid) then (yes)
+ * :read IDR of the group port once;
+ * :return (IDR & mask) >> offset;
+ * else (no)
+ * :Report Error;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr) {
+	if (NULL_PTR == ChannelGroupIdPtr) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID,
+		DIO_E_PARAM_POINTER);
+	} else if (Dio_GroupValid(ChannelGroupIdPtr) == FALSE) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID,
+		DIO_E_PARAM_INVALID_GROUP);
+	} else {
+		/*returns the channels of the group moved down to bit 0*/
+		return (Dio_PortLevelType) ((GPIO_PORT(ChannelGroupIdPtr->port)->IDR
+				& ChannelGroupIdPtr->mask) >> ChannelGroupIdPtr->offset);
+	}
+	return STD_PORTLOW;
+}
+
+/**
+ * \section Service_Name
+ * Dio_WriteChannelGroup
+ *
+ * \section Description
+ * Function to Write the Level of a group of adjoining channels of one port,
+ * all the channels of the group change in the same bus cycle
+ * \section Req_ID
+ * Dio_0x08
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] ChannelGroupIdPtr \Hold the port, mask and offset of the group
+ * \param[in] Level             \Hold the Level of the group starting at bit 0
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (group is valid) then (yes)
+ * :Set = (Level << offset) & mask;
+ * :Reset = ~Set & mask;
+ * :BSRR = Set | (Reset << 16) in one store;
+ * else (no)
+ * :Report Error;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr,
+		Dio_PortLevelType Level) {
+	uint32 SetBits;
+
+	if (NULL_PTR == ChannelGroupIdPtr) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID,
+		DIO_E_PARAM_POINTER);
+	} else if (Dio_GroupValid(ChannelGroupIdPtr) == FALSE) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID,
+		DIO_E_PARAM_INVALID_GROUP);
+	} else {
+		SetBits = (uint32) Level << ChannelGroupIdPtr->offset;
+		/*the set half and the reset half of BSRR in a single store, so the
+		 *channels outside the group are untouched and the group never shows
+		 *a mix of the old and the new level*/
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+		Dio_ShadowWrite(ChannelGroupIdPtr->port,
+				DIO_BSRR_VALUE(SetBits, ChannelGroupIdPtr->mask));
+#else
+		GPIO_BSRR_WRITE(GPIO_PORT(ChannelGroupIdPtr->port), DIO_BSRR_VALUE(SetBits,
+				ChannelGroupIdPtr->mask));
+#endif
+	}
+}
+
+/**
+ * \section Service_Name
+ * Dio_Snapshot
+ *
+ * \section Description
+ * Function to Read the input levels of all the ports, each IDR is read once
+ * \section Req_ID
+ * Dio_0x0A
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] SnapshotPtr \Hold the IDR of every port
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (SnapshotPtr is NULL) then (yes)
+ * :Report Error;
+ * else (no)
+ * while (more ports?)
+ * :Port[i] = IDR of port i;
+ * endwhile
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_Snapshot(Dio_PortsSnapshot *SnapshotPtr) {
+	uint8 Port;
+
+	if (NULL_PTR == SnapshotPtr) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_SNAPSHOT_SID,
+		DIO_E_PARAM_POINTER);
+	} else {
+		/*back to back reads, the channels are then taken from the snapshot*/
+		for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+			SnapshotPtr->Port[Port] = (Dio_PortLevelType) GPIO_PORT(Port)->IDR;
+		}
+	}
+}
+
+/**
+ * \section Service_Name
+ * Dio_OutputBatchCommit
+ *
+ * \section Description
+ * Function to Write the changes accumulated in an output batch, one BSRR
+ * store for each port with a change
+ * \section Req_ID
+ * Dio_0x0B
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] BatchPtr \Hold the BSRR value of every port, emptied after the commit
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (BatchPtr is NULL) then (yes)
+ * :Report Error;
+ * else (no)
+ * while (more ports?)
+ * if (Bsrr[i] != 0) then (yes)
+ * :BSRR of port i = Bsrr[i];
+ * :Bsrr[i] = 0;
+ * endif
+ * endwhile
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_OutputBatchCommit(Dio_OutputBatchType *BatchPtr) {
+	uint8 Port;
+
+	if (NULL_PTR == BatchPtr) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_OUTPUT_BATCH_COMMIT_SID,
+		DIO_E_PARAM_POINTER);
+	} else {
+		for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+			if (BatchPtr->Bsrr[Port] != 0) {
+				/*all the changes of the port in one store*/
+				GPIO_BSRR_WRITE(GPIO_PORT(Port), BatchPtr->Bsrr[Port]);
+				BatchPtr->Bsrr[Port] = 0;
+			}
+		}
+	}
+}
+
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+/**
+ * \section Service_Name
+ * Dio_ShadowCommit
+ *
+ * \section Description
+ * Function to apply the writes made since the previous commit, every changed
+ * port gets one BSRR store and the unchanged ports are not accessed
+ * \section Req_ID
+ * Dio_0x1C
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * :Mask interrupts;
+ * :take the shadow and empty it;
+ * :Restore interrupts;
+ * while (more ports?)
+ * if (port has pending writes) then (yes)
+ * :BSRR of the port = pending writes;
+ * endif
+ * endwhile
+ *
+ * end
+ * @enduml
+ */
+void Dio_ShadowCommit(void) {
+	Dio_OutputBatchType Pending;
+	uint32 InterruptState;
+	uint8 Port;
+
+	/*a write made from an interrupt goes either into this commit or the next*/
+	ENTER_CRITICAL_SECTION(InterruptState);
+	for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+		Pending.Bsrr[Port] = Dio_Shadow.Bsrr[Port];
+		Dio_Shadow.Bsrr[Port] = 0;
+	}
+	EXIT_CRITICAL_SECTION(InterruptState);
+
+	Dio_OutputBatchCommit(&Pending);
 }
+#endif
 
 /**
  * \section Service_Name
@@ -403,6 +743,6 @@ else {
 	versioninfo->moduleID = (uint16) DIO_MODULE_ID;
 
 	/* Copy Software Version */
-	versioninfo->sw_version = (uint8) DIO_SW_VERSION;
+	versioninfo->sw_major_version = (uint8) DIO_SW_VERSION;
 } //end else
 }
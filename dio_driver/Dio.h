@@ -299,7 +299,7 @@
  */
 
 /* Service ID for DIO ReadChannelGroup */
-#define Dio_ReadChannelGroup           (uint8)0x04
+#define DIO_READ_CHANNEL_GROUP_SID     (uint8)0x04
 
 /**
  * @brief Defination of API to be used in Det_ReportError
@@ -313,7 +313,7 @@
  */
 
 /* Service ID for DIO WriteChannelGroup */
-#define DIO_WriteChannelGroup          (uint8)0x05
+#define DIO_WRITE_CHANNEL_GROUP_SID    (uint8)0x05
 
 /**
  * @brief Defination of API to be used in Det_ReportError
@@ -342,6 +342,49 @@
 
 /* Service ID for DIO GetVersionInfo */
 #define DIO_GET_VERSION_INFO_SID       (uint8)0x12
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x13
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO write Port masked */
+#define DIO_WRITE_PORT_MASKED_SID      (uint8)0x13
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x14
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO snapshot */
+#define DIO_SNAPSHOT_SID               (uint8)0x14
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x15
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO output batch commit */
+#define DIO_OUTPUT_BATCH_COMMIT_SID    (uint8)0x15
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -362,19 +405,21 @@ typedef enum {
 } Dio_LevelType;
 
 /**
-  * @brief Enumeration for Level of Port.
+  * @brief Type for Level of Port, one bit per pin of the port.
   *
   *
   * @details
-  * - Type: enum
-  * - Range: 0,0xFF
+  * - Type: uint16
+  * - Range: 0:0xFFFF
   * - Resolution: 1U
   * - Unit: Bits
   */
 
-typedef enum {
-	STD_PORTLOW, STD_PORTHIGH = 0xFF
-} Dio_PortLevelType;
+typedef uint16 Dio_PortLevelType;
+
+/* All the pins of the port low / high */
+#define STD_PORTLOW    ((Dio_PortLevelType)0x0000U)
+#define STD_PORTHIGH   ((Dio_PortLevelType)0xFFFFU)
 
 /**
   * @brief Enumeration for Choosing the Channel.
@@ -411,6 +456,93 @@ typedef enum {
 	PORTA, PORTB, PORTC
 
 } Dio_PortType;
+
+/**
+  * @brief Structure for a group of adjoining channels of one port.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - mask   : positions of the group channels in the port, contiguous and starting at offset
+  * - offset : position of the first channel of the group in the port
+  * - port   : port the group belongs to
+  */
+
+typedef struct {
+	uint16 mask;
+	uint8 offset;
+	Dio_PortType port;
+} Dio_ChannelGroupType;
+
+/*
+ * A channel is encoded as (port << 4) | pin, so decoding it is a shift and a mask:
+ * no range compares and no table walk.
+ */
+#define DIO_CHANNEL_PORT(ChannelId)     ((uint32)(ChannelId) >> 4)
+#define DIO_CHANNEL_PIN(ChannelId)      ((uint32)(ChannelId) & 0x0FU)
+#define DIO_CHANNEL_MASK(ChannelId)     ((uint32)1U << DIO_CHANNEL_PIN(ChannelId))
+#define DIO_CHANNEL_REGS(ChannelId)     GPIO_PORT(DIO_CHANNEL_PORT(ChannelId))
+
+/* BSRR value giving the pins of Mask the levels of Level, the other pins are untouched */
+#define DIO_BSRR_VALUE(Level, Mask)     (((uint32)(Level) & (uint32)(Mask)) \
+		| (((uint32)~(uint32)(Level) & (uint32)(Mask)) << 16))
+
+/**
+  * @brief Structure holding the input levels of all the ports read at one time.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - Port : IDR of each Dio_PortType
+  */
+
+typedef struct {
+	Dio_PortLevelType Port[NUM_OF_PORTS];
+} Dio_PortsSnapshot;
+
+/**
+  * @brief Structure accumulating output changes of all the ports.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - Bsrr : BSRR value of each Dio_PortType, 0 when the port has no change
+  */
+
+typedef struct {
+	uint32 Bsrr[NUM_OF_PORTS];
+} Dio_OutputBatchType;
+
+/*
+ * Compile time channel handles of DIO_STATIC_CHANNELS: DIO_<NAME> is a constant
+ * channel, so the port base and the mask fold at compile time and
+ * DIO_STATIC_WRITE is a single store of a constant to a constant address.
+ * No parameter check and no Det_ReportError is involved, a wrong channel in
+ * the list is a build error.
+ */
+#define DIO_DECLARE_STATIC_CHANNEL(NAME, CHANNEL)	DIO_##NAME = (CHANNEL),
+#define DIO_CHECK_STATIC_CHANNEL(NAME, CHANNEL)	\
+	typedef char Dio_StaticChannelCheck_##NAME[((uint32) (CHANNEL) < NUM_OF_PINS) ? 1 : -1];
+
+enum {
+	DIO_STATIC_CHANNELS(DIO_DECLARE_STATIC_CHANNEL)
+	DIO_NUM_OF_STATIC_CHANNELS_END
+};
+
+DIO_STATIC_CHANNELS(DIO_CHECK_STATIC_CHANNEL)
+
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+/* the store would bypass the shadow, the build fails on DIO_STATIC_WRITE_NEEDS_SHADOW_OFF_<NAME> */
+#define DIO_STATIC_WRITE(NAME, LEVEL)	DIO_STATIC_WRITE_NEEDS_SHADOW_OFF_##NAME
+#else
+#define DIO_STATIC_WRITE(NAME, LEVEL)	GPIO_BSRR_WRITE(DIO_CHANNEL_REGS(DIO_##NAME), \
+		DIO_CHANNEL_MASK(DIO_##NAME) << ((~(uint32) (LEVEL) & STD_HIGH) << 4))
+#endif
+#define DIO_STATIC_READ(NAME)			((Dio_LevelType) ((DIO_CHANNEL_REGS(DIO_##NAME)->IDR \
+		>> DIO_CHANNEL_PIN(DIO_##NAME)) & STD_HIGH))
+
+/* Channel groups of the configuration declared in Dio_LCfg.c */
+extern const Dio_ChannelGroupType Dio_ChannelGroups[DIO_CONFIGURED_GROUPS];
 /*============================================================================*/
 
 /****************************************************************************
@@ -442,7 +574,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
  *
  * @param[in]     ChannelId     Type Dio_ChannelType     Range 0:48
  * @param[in]    Level			Type Dio_LevelType       Range 0:1
- * @return    Dio_PortLevelType Type Region_Enum         Range 0,0xFF
+ * @return    Dio_PortLevelType Type uint16              Range 0:0xFFFF
  */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 /**
@@ -450,10 +582,22 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
  * This function write a value to Port.
  *
  * @param[in]     PortId     Type Dio_PortType			  Range 0:2
- * @param[in]    Level		 Type Dio_PortLevelType       Range 0,0xFF
+ * @param[in]    Level		 Type Dio_PortLevelType       Range 0:0xFFFF
  * @return    none
  */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
+/**
+ *
+ * This function write a value to the pins of a Port selected by Mask,
+ * the other pins keep their level.
+ *
+ * @param[in]     PortId     Type Dio_PortType			  Range 0:2
+ * @param[in]    Level		 Type Dio_PortLevelType       Range 0:0xFFFF
+ * @param[in]    Mask		 Type Dio_PortLevelType       Range 0:0xFFFF
+ * @return    none
+ */
+void Dio_WritePortMasked(Dio_PortType PortId, Dio_PortLevelType Level,
+		Dio_PortLevelType Mask);
 /**
  *
  * This function That Flip the value of channel.
@@ -463,6 +607,52 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
  * @return        Dio_LevelType Type Region_Enum         Range 0:1
  */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
+/**
+ *
+ * This function Read the value of a channel group.
+ *
+ * @param[in]     ChannelGroupIdPtr  Type Dio_ChannelGroupType*
+ * @param[out]    none
+ * @return        Dio_PortLevelType  Level of the group shifted down to bit 0
+ */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr);
+/**
+ *
+ * This function write a value to a channel group with a single BSRR store.
+ *
+ * @param[in]     ChannelGroupIdPtr  Type Dio_ChannelGroupType*
+ * @param[in]     Level              Type Dio_PortLevelType  Level of the group starting at bit 0
+ * @return        none
+ */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr,
+		Dio_PortLevelType Level);
+/**
+ *
+ * This function Read the IDR of every port once into a snapshot.
+ *
+ * @param[out]    SnapshotPtr   Type Dio_PortsSnapshot*
+ * @return        none
+ */
+void Dio_Snapshot(Dio_PortsSnapshot *SnapshotPtr);
+/**
+ *
+ * This function write the accumulated changes of a batch, one BSRR store per
+ * changed port, and empties the batch.
+ *
+ * @param[inout]  BatchPtr      Type Dio_OutputBatchType*
+ * @return        none
+ */
+void Dio_OutputBatchCommit(Dio_OutputBatchType *BatchPtr);
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+/**
+ *
+ * This function applies the writes made since the previous commit, one BSRR
+ * store per changed port.
+ *
+ * @return        none
+ */
+void Dio_ShadowCommit(void);
+#endif
 /*====================================================================================*/
 /**
  *
@@ -473,27 +663,122 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
  * @param[in]    Level			Type Dio_LevelType       Range 0:1
  * @return    none
  */
-void Dio_SetPinValue(GPIO_REG *gpio_ptr, Dio_ChannelType ChannelId,
+void Dio_SetPinValue(volatile GPIO_REG *gpio_ptr, Dio_ChannelType ChannelId,
 		Dio_LevelType Level);
 /**
  *
- * This function Toggle the value of pin.
+ * This function Toggle the value of pin with a single BSRR store.
  *
- * @param[in]     ChannelId     Type Dio_ChannelType     Range 0:48,
+ * @param[in]     ChannelId     Type Dio_ChannelType     Range 0:15,
  *				  gpio_ptr		Type GPIO_REG
  * @param[out]    none
- * @return    none
+ * @return    Dio_LevelType  Level of the pin after toggling
  */
-void Dio_TogglePin(GPIO_REG *gpio_ptr, Dio_ChannelType ChannelId);
+Dio_LevelType Dio_TogglePin(volatile GPIO_REG *gpio_ptr, Dio_ChannelType ChannelId);
 /**
  *
- * This function sets the value of port.
+ * This function sets the value of port with a single BSRR store.
  *
  * @param[in]     gpio_ptr		Type GPIO_REG
- * @param[in]    Level			Type Dio_LevelType       Range 0:1
+ * @param[in]    Level			Type Dio_PortLevelType   Range 0:0xFFFF
+ * @param[in]    Mask			Type Dio_PortLevelType   Range 0:0xFFFF
  * @return    none
  */
-void Dio_SetPortValue(GPIO_REG *gpio_ptr, Dio_LevelType Level);
+void Dio_SetPortValue(volatile GPIO_REG *gpio_ptr, Dio_PortLevelType Level,
+		Dio_PortLevelType Mask);
 /*====================================================================================*/
 
+/****************************************************************************
+ ********************* Inline fast path **************************************
+ *****************************************************************************/
+
+/*
+ * Branchless accessors without parameter checking, ChannelId must be a valid
+ * Dio_ChannelType. Dio_ReadChannel and Dio_WriteChannel are these accessors
+ * behind the development error check.
+ */
+
+/**
+ *
+ * This function Read the value of channel.
+ *
+ * @param[in]     ChannelId     Type Dio_ChannelType     Range 0:47
+ * @return    Dio_LevelType   Type uint8             Range 0,1
+ */
+LOCAL_INLINE Dio_LevelType Dio_ReadChannelFast(Dio_ChannelType ChannelId) {
+#if (DIO_BITBAND_ACCESS == STD_ON)
+	return (Dio_LevelType) GPIO_BITBAND_READ(DIO_CHANNEL_REGS(ChannelId)->IDR,
+			DIO_CHANNEL_PIN(ChannelId));
+#else
+	return (Dio_LevelType) ((DIO_CHANNEL_REGS(ChannelId)->IDR
+			>> DIO_CHANNEL_PIN(ChannelId)) & STD_HIGH);
+#endif
+}
+#if (DIO_SHADOW_OUTPUT == STD_OFF)
+/**
+ *
+ * This function Write a value to channel, STD_HIGH uses the set half of BSRR
+ * and STD_LOW the reset half, or a single store to the ODR bit-band word.
+ * It writes the pin at once, so it is left out with DIO_SHADOW_OUTPUT STD_ON.
+ *
+ * @param[in]     ChannelId     Type Dio_ChannelType     Range 0:47
+ * @param[in]    Level			Type Dio_LevelType       Range 0:1
+ * @return    none
+ */
+LOCAL_INLINE void Dio_WriteChannelFast(Dio_ChannelType ChannelId,
+		Dio_LevelType Level) {
+#if (DIO_BITBAND_ACCESS == STD_ON)
+	GPIO_BITBAND_WRITE(DIO_CHANNEL_REGS(ChannelId)->ODR,
+			DIO_CHANNEL_PIN(ChannelId), Level);
+#else
+	GPIO_BSRR_WRITE(DIO_CHANNEL_REGS(ChannelId), DIO_CHANNEL_MASK(ChannelId)
+			<< ((~(uint32) Level & STD_HIGH) << 4));
+#endif
+}
+#endif
+/**
+ *
+ * This function Read the value of channel from a snapshot.
+ *
+ * @param[in]     SnapshotPtr   Type Dio_PortsSnapshot*
+ * @param[in]     ChannelId     Type Dio_ChannelType     Range 0:47
+ * @return    Dio_LevelType   Type uint8             Range 0,1
+ */
+LOCAL_INLINE Dio_LevelType Dio_SnapshotChannel(const Dio_PortsSnapshot *SnapshotPtr,
+		Dio_ChannelType ChannelId) {
+	return (Dio_LevelType) ((SnapshotPtr->Port[DIO_CHANNEL_PORT(ChannelId)]
+			>> DIO_CHANNEL_PIN(ChannelId)) & STD_HIGH);
+}
+/**
+ *
+ * This function empties an output batch.
+ *
+ * @param[out]    BatchPtr      Type Dio_OutputBatchType*
+ * @return    none
+ */
+LOCAL_INLINE void Dio_OutputBatchClear(Dio_OutputBatchType *BatchPtr) {
+	uint8 Port;
+	for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+		BatchPtr->Bsrr[Port] = 0;
+	}
+}
+/**
+ *
+ * This function adds a channel level to an output batch, the last level
+ * written to a channel before the commit wins.
+ *
+ * @param[inout]  BatchPtr      Type Dio_OutputBatchType*
+ * @param[in]     ChannelId     Type Dio_ChannelType     Range 0:47
+ * @param[in]     Level			Type Dio_LevelType       Range 0:1
+ * @return    none
+ */
+LOCAL_INLINE void Dio_OutputBatchWrite(Dio_OutputBatchType *BatchPtr,
+		Dio_ChannelType ChannelId, Dio_LevelType Level) {
+	uint32 Mask = DIO_CHANNEL_MASK(ChannelId);
+	uint32 Shift = (~(uint32) Level & STD_HIGH) << 4;
+	uint32 *Bsrr = &BatchPtr->Bsrr[DIO_CHANNEL_PORT(ChannelId)];
+	/*drop a previous opposite request of the channel then add this one*/
+	*Bsrr = (*Bsrr & ~(Mask | (Mask << 16))) | (Mask << Shift);
+}
+
 #endif /* DIO_PRIVATE_H_ */
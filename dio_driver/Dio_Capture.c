@@ -0,0 +1,471 @@
+/**
+ *@file       Dio_Capture.c
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio Capture Program File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio_Capture.h"
+#include "Det.h"
+
+/*====================================================================================*/
+
+/* First VCD identifier character, channel n is written as '!' + n */
+#define DIO_CAPTURE_VCD_ID_BASE     '!'
+
+/* Size of the text buffer of Dio_CaptureDump */
+#define DIO_CAPTURE_LINE_SIZE       64U
+
+/* Configuration given to Dio_CaptureStart */
+static Dio_CaptureConfigType Dio_CaptureConfig;
+
+/* Ring buffer of the run-length entries */
+static Dio_CaptureEntryType Dio_CaptureBuffer[DIO_CAPTURE_BUFFER_SIZE];
+
+/* Next entry to write, number of valid entries and index of the trigger entry */
+static uint16 Dio_CaptureHead = 0;
+static uint16 Dio_CaptureCount = 0;
+static uint16 Dio_CaptureTriggerEntry = 0;
+
+/* Samples and entries recorded from the trigger on */
+static uint16 Dio_CaptureAfterTrigger = 0;
+static uint16 Dio_CaptureTriggerEntries = 0;
+
+static volatile Dio_CaptureStateType Dio_CaptureState = DIO_CAPTURE_IDLE;
+
+/* Text waiting to be sent by Dio_CaptureDump */
+typedef struct {
+	uint8 Text[DIO_CAPTURE_LINE_SIZE];
+	uint8 Length;
+	USART_ID Uart;
+} Dio_CaptureLineType;
+
+/*====================================================================================*/
+
+/* Send the buffered text */
+static void Dio_CaptureFlush(Dio_CaptureLineType *Line) {
+	if (Line->Length != 0) {
+		USART_TransmitString(Line->Uart, Line->Text, Line->Length,
+		DIO_CAPTURE_DUMP_TIMEOUT);
+		Line->Length = 0;
+	}
+}
+
+/* Append a character, the buffer is sent when full */
+static void Dio_CapturePutChar(Dio_CaptureLineType *Line, uint8 Character) {
+	if (Line->Length == DIO_CAPTURE_LINE_SIZE) {
+		Dio_CaptureFlush(Line);
+	}
+	Line->Text[Line->Length++] = Character;
+}
+
+static void Dio_CapturePutString(Dio_CaptureLineType *Line, const char *String) {
+	while (*String != '\0') {
+		Dio_CapturePutChar(Line, (uint8) *String++);
+	}
+}
+
+/* Append the decimal representation of Value */
+static void Dio_CapturePutNumber(Dio_CaptureLineType *Line, uint64 Value) {
+	uint8 Digits[20];
+	uint8 Length = 0;
+
+	do {
+		Digits[Length++] = (uint8) ('0' + (Value % 10));
+		Value /= 10;
+	} while (Value != 0);
+
+	/*digits were produced least significant first*/
+	while (Length != 0) {
+		Dio_CapturePutChar(Line, Digits[--Length]);
+	}
+}
+
+/* Append a "#<time>" line, the time in us of the sample number Sample */
+static void Dio_CapturePutTime(Dio_CaptureLineType *Line, uint64 Sample) {
+	Dio_CapturePutChar(Line, '#');
+	Dio_CapturePutNumber(Line, Sample * DIO_CAPTURE_SAMPLE_PERIOD_US);
+	Dio_CapturePutChar(Line, '\n');
+}
+
+/* TRUE when Sample meets the trigger condition */
+static boolean Dio_CaptureTriggerHit(const Dio_PortLevelType *Sample) {
+	uint8 Port;
+
+	for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+		if ((Sample[Port] & Dio_CaptureConfig.TriggerMask[Port])
+				!= Dio_CaptureConfig.TriggerValue[Port]) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/*====================================================================================*/
+
+/**
+ * \section Service_Name
+ * Dio_CaptureStart
+ *
+ * \section Description
+ * Function to empty the capture buffer and arm the trigger
+ * \section Req_ID
+ * Dio_0x17
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Asynchronous
+ *
+ * \param[in] ConfigPtr \Hold the recorded channels and the trigger
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (ConfigPtr is NULL) then (yes)
+ * :Report Error;
+ * else (no)
+ * :State = IDLE;
+ * :copy the configuration, keep the trigger inside the recorded channels;
+ * :empty the buffer;
+ * :State = ARMED;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_CaptureStart(const Dio_CaptureConfigType *ConfigPtr) {
+	uint8 Port;
+
+	if (NULL_PTR == ConfigPtr) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_CAPTURE_START_SID,
+		DIO_E_PARAM_CONFIG);
+		return;
+	}
+
+	/*the tick does nothing while the configuration changes*/
+	Dio_CaptureState = DIO_CAPTURE_IDLE;
+
+	Dio_CaptureConfig = *ConfigPtr;
+	for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+		Dio_CaptureConfig.TriggerMask[Port] &= ConfigPtr->ChannelMask[Port];
+		Dio_CaptureConfig.TriggerValue[Port] &= Dio_CaptureConfig.TriggerMask[Port];
+	}
+	Dio_CaptureHead = 0;
+	Dio_CaptureCount = 0;
+	Dio_CaptureAfterTrigger = 0;
+	Dio_CaptureTriggerEntries = 0;
+
+	Dio_CaptureState = DIO_CAPTURE_ARMED;
+}
+
+/**
+ * \section Service_Name
+ * Dio_CaptureStop
+ *
+ * \section Description
+ * Function to stop the capture and keep the recorded entries
+ * \section Req_ID
+ * Dio_0x18
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ * :State = DONE;
+ * end
+ * @enduml
+ */
+void Dio_CaptureStop(void) {
+	Dio_CaptureState = DIO_CAPTURE_DONE;
+}
+
+/**
+ * \section Service_Name
+ * Dio_CaptureGetState
+ *
+ * \section Description
+ * Function to get the state of the capture
+ * \section Req_ID
+ * Dio_0x19
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return Dio_CaptureStateType
+ *
+ * @startuml
+ * start
+ * :return State;
+ * end
+ * @enduml
+ */
+Dio_CaptureStateType Dio_CaptureGetState(void) {
+	return Dio_CaptureState;
+}
+
+/**
+ * \section Service_Name
+ * Dio_CaptureTick
+ *
+ * \section Description
+ * Function to take one sample of the recorded channels
+ * \section Req_ID
+ * Dio_0x1A
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] Context \Unused, matches Systick_NotificationType
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (ARMED or TRIGGERED) then (yes)
+ * :Sample = IDR & ChannelMask of every port;
+ * if (ARMED and trigger condition) then (yes)
+ * :State = TRIGGERED, the sample opens a new entry;
+ * endif
+ * if (same as the last entry and not the trigger) then (yes)
+ * :Repeat++;
+ * elseif (TRIGGERED and the buffer holds only post-trigger entries) then (yes)
+ * :State = DONE;
+ * stop
+ * else (no)
+ * :write a new entry, overwrite the oldest when full;
+ * endif
+ * if (TRIGGERED and PostTriggerSamples recorded) then (yes)
+ * :State = DONE;
+ * endif
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_CaptureTick(void *Context) {
+	Dio_PortLevelType Sample[NUM_OF_PORTS];
+	Dio_CaptureEntryType *Last;
+	boolean NewEntry;
+	boolean Trigger = FALSE;
+	uint8 Port;
+
+	(void) Context;
+
+	if ((Dio_CaptureState != DIO_CAPTURE_ARMED)
+			&& (Dio_CaptureState != DIO_CAPTURE_TRIGGERED)) {
+		return;
+	}
+
+	for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+		Sample[Port] = (Dio_PortLevelType) (GPIO_PORT(Port)->IDR
+				& Dio_CaptureConfig.ChannelMask[Port]);
+	}
+
+	if ((Dio_CaptureState == DIO_CAPTURE_ARMED) && Dio_CaptureTriggerHit(Sample)) {
+		Trigger = TRUE;
+		Dio_CaptureState = DIO_CAPTURE_TRIGGERED;
+	}
+
+	/*the trigger always opens an entry so the dump can mark it*/
+	NewEntry = (Dio_CaptureCount == 0) || Trigger;
+	Last = &Dio_CaptureBuffer[(Dio_CaptureHead + DIO_CAPTURE_BUFFER_SIZE - 1U)
+			% DIO_CAPTURE_BUFFER_SIZE];
+	if ((!NewEntry) && (Last->Repeat != 0xFFFFU)) {
+		for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+			if (Sample[Port] != Last->Sample[Port]) {
+				NewEntry = TRUE;
+			}
+		}
+	} else {
+		NewEntry = TRUE;
+	}
+
+	if (!NewEntry) {
+		Last->Repeat++;
+	} else {
+		if (Dio_CaptureState == DIO_CAPTURE_TRIGGERED) {
+			/*a further entry would overwrite the trigger entry*/
+			if (Dio_CaptureTriggerEntries >= DIO_CAPTURE_BUFFER_SIZE) {
+				Dio_CaptureState = DIO_CAPTURE_DONE;
+				return;
+			}
+			if (Trigger) {
+				Dio_CaptureTriggerEntry = Dio_CaptureHead;
+			}
+			Dio_CaptureTriggerEntries++;
+		}
+
+		for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+			Dio_CaptureBuffer[Dio_CaptureHead].Sample[Port] = Sample[Port];
+		}
+		Dio_CaptureBuffer[Dio_CaptureHead].Repeat = 1;
+		Dio_CaptureHead = (uint16) ((Dio_CaptureHead + 1U) % DIO_CAPTURE_BUFFER_SIZE);
+		if (Dio_CaptureCount < DIO_CAPTURE_BUFFER_SIZE) {
+			Dio_CaptureCount++;
+		}
+	}
+
+	/*the post-trigger length counts ticks, a level held after the trigger ends it too*/
+	if (Dio_CaptureState == DIO_CAPTURE_TRIGGERED) {
+		Dio_CaptureAfterTrigger++;
+		if ((Dio_CaptureConfig.PostTriggerSamples != 0)
+				&& (Dio_CaptureAfterTrigger >= Dio_CaptureConfig.PostTriggerSamples)) {
+			Dio_CaptureState = DIO_CAPTURE_DONE;
+		}
+	}
+}
+
+/**
+ * \section Service_Name
+ * Dio_CaptureDump
+ *
+ * \section Description
+ * Function to send the capture over UART as a Value Change Dump file
+ * \section Req_ID
+ * Dio_0x1B
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] UART_ID \Hold the UART to send the file on
+ * \param[inout] None
+ * \param[out] None
+ * \return Std_ReturnType
+ *
+ * @startuml
+ * start
+ *
+ * if (ARMED or TRIGGERED) then (yes)
+ * :return E_NOT_OK;
+ * stop
+ * endif
+ * :send the header with a $var line per recorded channel;
+ * :send the trigger time as a comment;
+ * while (more entries from the oldest?)
+ * :send #time and the channels changed since the previous entry;
+ * :time += Repeat;
+ * endwhile
+ * :send the end time;
+ * :return E_OK;
+ *
+ * end
+ * @enduml
+ */
+Std_ReturnType Dio_CaptureDump(USART_ID UART_ID) {
+	Dio_CaptureLineType Line;
+	const Dio_CaptureEntryType *Entry;
+	const Dio_CaptureEntryType *Previous = NULL_PTR;
+	uint64 Time = 0;
+	uint16 Index;
+	uint16 Count;
+	uint8 Port;
+	uint8 Pin;
+
+	if ((Dio_CaptureState == DIO_CAPTURE_ARMED)
+			|| (Dio_CaptureState == DIO_CAPTURE_TRIGGERED)) {
+		return E_NOT_OK;
+	}
+
+	Line.Length = 0;
+	Line.Uart = UART_ID;
+
+	Dio_CapturePutString(&Line, "$timescale 1 us $end\n$scope module dio $end\n");
+	for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+		for (Pin = 0; Pin < 16U; Pin++) {
+			if (GET_BIT(Dio_CaptureConfig.ChannelMask[Port], Pin)) {
+				Dio_CapturePutString(&Line, "$var wire 1 ");
+				Dio_CapturePutChar(&Line, (uint8) (DIO_CAPTURE_VCD_ID_BASE + (Port << 4) + Pin));
+				Dio_CapturePutChar(&Line, ' ');
+				Dio_CapturePutChar(&Line, (uint8) ('A' + Port));
+				Dio_CapturePutNumber(&Line, Pin);
+				Dio_CapturePutString(&Line, " $end\n");
+			}
+		}
+	}
+	Dio_CapturePutString(&Line, "$upscope $end\n$enddefinitions $end\n");
+
+	/*entries from the oldest one on*/
+	Index = (uint16) ((Dio_CaptureHead + DIO_CAPTURE_BUFFER_SIZE - Dio_CaptureCount)
+			% DIO_CAPTURE_BUFFER_SIZE);
+	for (Count = 0; Count < Dio_CaptureCount; Count++) {
+		Entry = &Dio_CaptureBuffer[Index];
+		if ((Dio_CaptureTriggerEntries != 0) && (Index == Dio_CaptureTriggerEntry)) {
+			Dio_CapturePutString(&Line, "$comment trigger $end\n");
+		}
+		Dio_CapturePutTime(&Line, Time);
+		for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+			for (Pin = 0; Pin < 16U; Pin++) {
+				if (GET_BIT(Dio_CaptureConfig.ChannelMask[Port], Pin)
+						&& ((Previous == NULL_PTR)
+								|| (GET_BIT((Entry->Sample[Port] ^ Previous->Sample[Port]), Pin)))) {
+					Dio_CapturePutChar(&Line, (uint8) ('0' + GET_BIT(Entry->Sample[Port], Pin)));
+					Dio_CapturePutChar(&Line, (uint8) (DIO_CAPTURE_VCD_ID_BASE + (Port << 4) + Pin));
+					Dio_CapturePutChar(&Line, '\n');
+				}
+			}
+		}
+		Time += Entry->Repeat;
+		Previous = Entry;
+		Index = (uint16) ((Index + 1U) % DIO_CAPTURE_BUFFER_SIZE);
+	}
+	/*the last entry lasts until the end time*/
+	Dio_CapturePutTime(&Line, Time);
+	Dio_CaptureFlush(&Line);
+	return E_OK;
+}
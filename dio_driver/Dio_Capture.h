@@ -0,0 +1,166 @@
+/**
+ *@file       Dio_Capture.h
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio Capture Header File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+#ifndef DIO_CAPTURE_H_
+#define DIO_CAPTURE_H_
+
+/*============================================================================*/
+/**
+* \file Dio_Capture.h
+*
+* @section Introduction
+*
+* Logic analyzer on the DIO ports. Dio_CaptureTick samples the IDR of every port
+* and stores the selected channels run-length encoded in a ring buffer: an
+* entry is a sample and the number of following ticks it stayed unchanged.
+*
+* Once armed the buffer is overwritten until the trigger condition
+* ((IDR & TriggerMask) == TriggerValue on every port) holds; the capture then
+* stops after PostTriggerSamples ticks, counted from the trigger sample on, or
+* before an entry would overwrite the trigger entry. Dio_CaptureDump sends
+* the capture as a Value Change Dump (VCD) file, which sigrok / PulseView import.
+*
+* Dio_CaptureTick has the signature of a SysTick notification, it is started
+* with Systick_StartTimerWithCallback(Period, Dio_CaptureTick, NULL_PTR) where
+* Period matches DIO_CAPTURE_SAMPLE_PERIOD_US.
+*
+*
+* \section Scope
+* Public
+*
+*/
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio.h"
+#include "Uart.h"
+
+/*******************************************************************************
+ *                      API Service Id Macros                                  *
+ *******************************************************************************/
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x1B
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO capture start */
+#define DIO_CAPTURE_START_SID          (uint8)0x1B
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/**
+  * @brief Enumeration for the state of the capture.
+  *
+  *
+  * @details
+  * - Type: enum
+  * - Range: 0:3
+  * - Resolution: 1U
+  * - Unit: Bits
+  */
+
+typedef enum {
+	DIO_CAPTURE_IDLE, DIO_CAPTURE_ARMED, DIO_CAPTURE_TRIGGERED, DIO_CAPTURE_DONE
+} Dio_CaptureStateType;
+
+/**
+  * @brief Structure for the configuration of a capture.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - ChannelMask        : channels of each port to record
+  * - TriggerMask        : channels of each port the trigger looks at, all 0 triggers at once
+  * - TriggerValue       : levels of the TriggerMask channels that trigger
+  * - PostTriggerSamples : ticks recorded from the trigger sample on, 0 records until the
+  *                        post-trigger entries fill the buffer
+  */
+
+typedef struct {
+	Dio_PortLevelType ChannelMask[NUM_OF_PORTS];
+	Dio_PortLevelType TriggerMask[NUM_OF_PORTS];
+	Dio_PortLevelType TriggerValue[NUM_OF_PORTS];
+	uint16 PostTriggerSamples;
+} Dio_CaptureConfigType;
+
+/**
+  * @brief Structure for one run-length encoded entry of the capture.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - Sample : recorded channels of each port
+  * - Repeat : number of ticks the sample lasted, at least 1
+  */
+
+typedef struct {
+	Dio_PortLevelType Sample[NUM_OF_PORTS];
+	uint16 Repeat;
+} Dio_CaptureEntryType;
+
+/****************************************************************************
+ ********************* Function definitions **********************************
+ *****************************************************************************/
+
+/**
+ *
+ * This function empties the buffer and arms the capture.
+ *
+ * @param[in]     ConfigPtr     Type Dio_CaptureConfigType*
+ * @return    none
+ */
+void Dio_CaptureStart(const Dio_CaptureConfigType *ConfigPtr);
+/**
+ *
+ * This function stops the capture, the recorded entries are kept.
+ *
+ * @return    none
+ */
+void Dio_CaptureStop(void);
+/**
+ *
+ * This function returns the state of the capture.
+ *
+ * @return    Dio_CaptureStateType
+ */
+Dio_CaptureStateType Dio_CaptureGetState(void);
+/**
+ *
+ * This function takes one sample, to be called at DIO_CAPTURE_SAMPLE_PERIOD_US.
+ *
+ * @param[in]     Context       Unused, the tick is a SysTick notification
+ * @return    none
+ */
+void Dio_CaptureTick(void *Context);
+/**
+ *
+ * This function sends the capture as a VCD file.
+ *
+ * @param[in]     UART_ID       Type USART_ID
+ * @return    Std_ReturnType  E_NOT_OK while the capture is running
+ */
+Std_ReturnType Dio_CaptureDump(USART_ID UART_ID);
+
+#endif /* DIO_CAPTURE_H_ */
@@ -0,0 +1,289 @@
+/**
+ *@file       Dio_Debounce.c
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio Debounce Program File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio_Debounce.h"
+#include "Det.h"
+
+/*====================================================================================*/
+
+/* Configuration given to Dio_DebounceInit, NULL_PTR before the init */
+static const Dio_DebounceConfigType *Dio_DebounceConfig = NULL_PTR;
+
+/* Debounced level of each port */
+static volatile Dio_PortLevelType Dio_DebounceState[NUM_OF_PORTS];
+
+/*
+ * Vertical counters: bit n of Count0 / Count1 is the low / high bit of the
+ * number of consecutive samples of pin n that differ from its debounced level,
+ * zero for every pin whose last sample equals its debounced level.
+ */
+static Dio_PortLevelType Dio_DebounceCount0[NUM_OF_PORTS];
+static Dio_PortLevelType Dio_DebounceCount1[NUM_OF_PORTS];
+
+/*====================================================================================*/
+
+/**
+ * \section Service_Name
+ * Dio_DebounceInit
+ *
+ * \section Description
+ * Function to start debouncing the channels of the configuration, their
+ * current levels are taken as the debounced levels
+ * \section Req_ID
+ * Dio_0x0C
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] ConfigPtr \Hold the channels to debounce and the edge notification
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (ConfigPtr is NULL) then (yes)
+ * :Report Error;
+ * else (no)
+ * while (more ports?)
+ * :State = IDR & Mask;
+ * :Clear the counters;
+ * endwhile
+ * :Save ConfigPtr;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_DebounceInit(const Dio_DebounceConfigType *ConfigPtr) {
+	uint8 Port;
+
+	if (NULL_PTR == ConfigPtr) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_DEBOUNCE_INIT_SID,
+		DIO_E_PARAM_CONFIG);
+	} else {
+		/*no tick works on a half initialized state*/
+		Dio_DebounceConfig = NULL_PTR;
+		for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+			Dio_DebounceState[Port] = (Dio_PortLevelType) (GPIO_PORT(Port)->IDR
+					& ConfigPtr->Mask[Port]);
+			Dio_DebounceCount0[Port] = 0;
+			Dio_DebounceCount1[Port] = 0;
+		}
+		Dio_DebounceConfig = ConfigPtr;
+	}
+}
+
+/**
+ * \section Service_Name
+ * Dio_DebounceTick
+ *
+ * \section Description
+ * Function to sample the configured channels, all the pins of a port are
+ * debounced together with one IDR read and a few bitwise operations
+ * \section Req_ID
+ * Dio_0x0D
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] Context \Unused, matches Systick_NotificationType
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (initialized?) then (yes)
+ * while (more ports with channels?)
+ * :Delta = (IDR & Mask) ^ State;
+ * :Count the pins in Delta, clear the others;
+ * :Toggle = pins counted to 3;
+ * :State ^= Toggle;
+ * :Clear the counters of the pins sampled at State;
+ * while (more pins in Toggle?)
+ * :notify rising or falling edge;
+ * endwhile
+ * endwhile
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_DebounceTick(void *Context) {
+	const Dio_DebounceConfigType *Config = Dio_DebounceConfig;
+	uint8 Port;
+	uint8 Pin;
+	Dio_PortLevelType Sample;
+	Dio_PortLevelType Delta;
+	Dio_PortLevelType Carry;
+	Dio_PortLevelType Toggle;
+	Dio_PortLevelType State;
+
+	(void) Context;
+
+	if (NULL_PTR == Config) {
+		return;
+	}
+
+	for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+		if (Config->Mask[Port] == 0) {
+			continue;
+		}
+		/*pins whose sample differs from their debounced level*/
+		Sample = (Dio_PortLevelType) (GPIO_PORT(Port)->IDR & Config->Mask[Port]);
+		Delta = Sample ^ Dio_DebounceState[Port];
+		/*count them up by one, a pin back at its level restarts from 0*/
+		Carry = Dio_DebounceCount0[Port] & Delta;
+		Dio_DebounceCount0[Port] = (Dio_PortLevelType) (~Dio_DebounceCount0[Port] & Delta);
+		Dio_DebounceCount1[Port] = (Dio_PortLevelType) ((Dio_DebounceCount1[Port] ^ Carry) & Delta);
+		/*pins which reached DIO_DEBOUNCE_SAMPLES take their new level*/
+		Toggle = Dio_DebounceCount0[Port] & Dio_DebounceCount1[Port];
+		State = Dio_DebounceState[Port] ^ Toggle;
+		Dio_DebounceState[Port] = State;
+		/*pins whose sample equals their debounced level, the toggled ones included, restart from 0*/
+		Delta = Sample ^ State;
+		Dio_DebounceCount0[Port] &= Delta;
+		Dio_DebounceCount1[Port] &= Delta;
+		if (Toggle == 0) {
+			continue;
+		}
+
+		if (Config->Notification != NULL_PTR) {
+			for (Pin = 0; Toggle != 0; Pin++, Toggle >>= 1) {
+				if (Toggle & 1U) {
+					Config->Notification((Dio_ChannelType) ((Port << 4) | Pin),
+							GET_BIT(State, Pin) ? DIO_EDGE_RISING : DIO_EDGE_FALLING);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * \section Service_Name
+ * Dio_DebounceReadChannel
+ *
+ * \section Description
+ * Function to Read the debounced Level of a channel
+ * \section Req_ID
+ * Dio_0x0E
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] ChannelId \Hold the Channel Id
+ * \param[inout] None
+ * \param[out] None
+ * \return Dio_LevelType
+ *
+ * @startuml
+ * start
+ *
+ * if (initialized and ChannelId valid) then (yes)
+ * :return the pin of the debounced State;
+ * else (no)
+ * :Report Error;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+Dio_LevelType Dio_DebounceReadChannel(Dio_ChannelType ChannelId) {
+	if (NULL_PTR == Dio_DebounceConfig) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+		DIO_DEBOUNCE_READ_CHANNEL_SID, DIO_E_UNINIT);
+	} else if ((uint32) ChannelId >= NUM_OF_PINS) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+		DIO_DEBOUNCE_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	} else {
+		return (Dio_LevelType) ((Dio_DebounceState[DIO_CHANNEL_PORT(ChannelId)]
+				>> DIO_CHANNEL_PIN(ChannelId)) & STD_HIGH);
+	}
+	return STD_LOW;
+}
+
+/**
+ * \section Service_Name
+ * Dio_DebounceReadPort
+ *
+ * \section Description
+ * Function to Read the debounced Levels of a Port
+ * \section Req_ID
+ * Dio_0x0F
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] PortId \Hold the PortId
+ * \param[inout] None
+ * \param[out] None
+ * \return Dio_PortLevelType
+ *
+ * @startuml
+ * start
+ *
+ * if (initialized and PortId valid) then (yes)
+ * :return the debounced State of the port;
+ * else (no)
+ * :Report Error;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+Dio_PortLevelType Dio_DebounceReadPort(Dio_PortType PortId) {
+	if (NULL_PTR == Dio_DebounceConfig) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+		DIO_DEBOUNCE_READ_PORT_SID, DIO_E_UNINIT);
+	} else if ((uint32) PortId >= NUM_OF_PORTS) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+		DIO_DEBOUNCE_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+	} else {
+		return Dio_DebounceState[PortId];
+	}
+	return STD_PORTLOW;
+}
@@ -0,0 +1,180 @@
+/**
+ *@file       Dio_Debounce.h
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio Debounce Header File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+#ifndef DIO_DEBOUNCE_H_
+#define DIO_DEBOUNCE_H_
+
+/*============================================================================*/
+/**
+* \file Dio_Debounce.h
+*
+* @section Introduction
+*
+* Debounce service of the DIO driver. The configured channels are sampled from
+* a periodic tick and every port is filtered at once with 2-bit vertical
+* counters: a channel takes a new level after DIO_DEBOUNCE_SAMPLES (3)
+* consecutive samples at that level, and its edge is reported to the
+* notification of the configuration.
+*
+* Dio_DebounceTick has the signature of a SysTick notification, the tick is
+* started with
+* Systick_StartTimerWithCallback(DIO_DEBOUNCE_PERIOD_MS, Dio_DebounceTick, NULL_PTR)
+* while the Systick channel is in SYSTICK_PERIODIC_INTERVAL mode.
+*
+*
+* \section Scope
+* Public
+*
+*/
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio.h"
+
+/*******************************************************************************
+ *                      API Service Id Macros                                  *
+ *******************************************************************************/
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x16
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO debounce init */
+#define DIO_DEBOUNCE_INIT_SID          (uint8)0x16
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x17
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO debounce read channel */
+#define DIO_DEBOUNCE_READ_CHANNEL_SID  (uint8)0x17
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x1E
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO debounce read port */
+#define DIO_DEBOUNCE_READ_PORT_SID     (uint8)0x1E
+
+/*
+ * Number of consecutive samples at the new level before a channel changes,
+ * fixed by the 2-bit counters.
+ */
+#define DIO_DEBOUNCE_SAMPLES           (3U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/**
+  * @brief Enumeration for the edge of a debounced channel.
+  *
+  *
+  * @details
+  * - Type: enum
+  * - Range: 0:1
+  * - Resolution: 1U
+  * - Unit: Bits
+  */
+
+typedef enum {
+	DIO_EDGE_FALLING, DIO_EDGE_RISING
+} Dio_EdgeType;
+
+/* Notification called from the tick for each debounced edge */
+typedef void (*Dio_DebounceNotificationType)(Dio_ChannelType ChannelId,
+		Dio_EdgeType Edge);
+
+/**
+  * @brief Structure for the configuration of the debounce service.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - Mask         : channels of each port to debounce
+  * - Notification : edge notification, NULL_PTR for none
+  */
+
+typedef struct {
+	Dio_PortLevelType Mask[NUM_OF_PORTS];
+	Dio_DebounceNotificationType Notification;
+} Dio_DebounceConfigType;
+
+/* Debounce configuration declared in Dio_LCfg.c */
+extern const Dio_DebounceConfigType Dio_DebounceConfiguration;
+
+/****************************************************************************
+ ********************* Function definitions **********************************
+ *****************************************************************************/
+
+/**
+ *
+ * This function takes the configuration and the current levels of its channels
+ * as the debounced levels.
+ *
+ * @param[in]     ConfigPtr     Type Dio_DebounceConfigType*
+ * @return    none
+ */
+void Dio_DebounceInit(const Dio_DebounceConfigType *ConfigPtr);
+/**
+ *
+ * This function samples the configured channels and updates their debounced
+ * levels, to be called periodically.
+ *
+ * @param[in]     Context       Unused, the tick is a SysTick notification
+ * @return    none
+ */
+void Dio_DebounceTick(void *Context);
+/**
+ *
+ * This function Read the debounced value of channel.
+ *
+ * @param[in]     ChannelId     Type Dio_ChannelType     Range 0:47
+ * @return    Dio_LevelType   Type uint8             Range 0,1
+ */
+Dio_LevelType Dio_DebounceReadChannel(Dio_ChannelType ChannelId);
+/**
+ *
+ * This function Read the debounced value of a Port, the channels out of the
+ * configuration read low.
+ *
+ * @param[in]     PortId     Type Dio_PortType			  Range 0:2
+ * @return    Dio_PortLevelType Type uint16              Range 0:0xFFFF
+ */
+Dio_PortLevelType Dio_DebounceReadPort(Dio_PortType PortId);
+
+#endif /* DIO_DEBOUNCE_H_ */
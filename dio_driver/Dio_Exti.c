@@ -0,0 +1,342 @@
+/**
+ *@file       Dio_Exti.c
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio External Interrupt Program File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio_Exti.h"
+#include "Det.h"
+#include "Systick.h"
+
+#if ((DIO_EXTI_FIFO_SIZE & (DIO_EXTI_FIFO_SIZE - 1)) != 0) || (DIO_EXTI_FIFO_SIZE > 128)
+  #error "DIO_EXTI_FIFO_SIZE must be a power of 2 not above 128"
+#endif
+
+/*====================================================================================*/
+
+/* NVIC interrupt numbers of the EXTI lines */
+#define DIO_EXTI0_IRQ          (6U)
+#define DIO_EXTI9_5_IRQ        (23U)
+#define DIO_EXTI15_10_IRQ      (40U)
+
+/* Lines served by each interrupt handler */
+#define DIO_EXTI9_5_LINES      (0x03E0U)
+#define DIO_EXTI15_10_LINES    (0xFC00U)
+
+/* Configuration of the channel on each EXTI line, NULL_PTR for a free line */
+static const Dio_ExtiChannelConfigType *Dio_ExtiLines[DIO_EXTI_NUM_OF_LINES];
+
+/*
+ * Event FIFO: the interrupt handlers write at Head, the application reads at
+ * Tail. Head and Tail run freely and are masked on access, Head - Tail is the
+ * number of queued events.
+ */
+static volatile Dio_ExtiEventType Dio_ExtiFifo[DIO_EXTI_FIFO_SIZE];
+static volatile uint8 Dio_ExtiFifoHead = 0;
+static volatile uint8 Dio_ExtiFifoTail = 0;
+static volatile uint32 Dio_ExtiOverflowCount = 0;
+
+/*====================================================================================*/
+
+/* NVIC interrupt number of an EXTI line */
+static uint8 Dio_ExtiLineIrq(uint8 Line) {
+	if (Line < 5U) {
+		return (uint8) (DIO_EXTI0_IRQ + Line);
+	} else if (Line < 10U) {
+		return DIO_EXTI9_5_IRQ;
+	} else {
+		return DIO_EXTI15_10_IRQ;
+	}
+}
+
+/*
+ * Clear and process the pending lines of Lines. The EXTI handlers can preempt
+ * each other, so the slot of the FIFO is taken with interrupts masked; the
+ * reader only moves Tail and never needs a lock.
+ */
+static void Dio_ExtiProcess(uint32 Lines) {
+	uint32 Pending = EXTI->PR & EXTI->IMR & Lines;
+	uint32 Timestamp = Systick_GetTimestamp();
+	uint32 InterruptState;
+	const Dio_ExtiChannelConfigType *Channel;
+	Dio_ExtiEventType Event;
+	uint8 Line;
+	uint8 Head;
+
+	/*writing 1 clears the pending bit*/
+	EXTI->PR = Pending;
+
+	for (Line = 0; Pending != 0; Line++, Pending >>= 1) {
+		if (!(Pending & 1U) || (Dio_ExtiLines[Line] == NULL_PTR)) {
+			continue;
+		}
+		Channel = Dio_ExtiLines[Line];
+		Event.ChannelId = Channel->ChannelId;
+		Event.Level = Dio_ReadChannelFast(Channel->ChannelId);
+		Event.Timestamp = Timestamp;
+
+		ENTER_CRITICAL_SECTION(InterruptState);
+		Head = Dio_ExtiFifoHead;
+		if ((uint8) (Head - Dio_ExtiFifoTail) < DIO_EXTI_FIFO_SIZE) {
+			Dio_ExtiFifo[Head & (DIO_EXTI_FIFO_SIZE - 1)].ChannelId = Event.ChannelId;
+			Dio_ExtiFifo[Head & (DIO_EXTI_FIFO_SIZE - 1)].Level = Event.Level;
+			Dio_ExtiFifo[Head & (DIO_EXTI_FIFO_SIZE - 1)].Timestamp = Event.Timestamp;
+			/*published after the event is written*/
+			Dio_ExtiFifoHead = (uint8) (Head + 1U);
+		} else {
+			Dio_ExtiOverflowCount++;
+		}
+		EXIT_CRITICAL_SECTION(InterruptState);
+
+		if (Channel->Notification != NULL_PTR) {
+			Channel->Notification(&Event);
+		}
+	}
+}
+
+/*====================================================================================*/
+
+/**
+ * \section Service_Name
+ * Dio_ExtiInit
+ *
+ * \section Description
+ * Function to enable the edge detection of the configured channels
+ * \section Req_ID
+ * Dio_0x10
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] ConfigPtr \Hold the DIO_EXTI_CONFIGURED_CHANNELS channels
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (ConfigPtr is NULL) then (yes)
+ * :Report Error;
+ * stop
+ * endif
+ * :Enter critical section;
+ * :mask and free the lines of the previous init;
+ * :Exit critical section;
+ * :Enable the AFIO clock;
+ * while (more channels?)
+ * if (channel invalid or line already used) then (yes)
+ * :Report Error;
+ * else (no)
+ * :route the line to the port of the channel in EXTICR;
+ * :select the rising / falling edges;
+ * :clear a stale pending bit and unmask the line;
+ * :enable the NVIC interrupt of the line;
+ * endif
+ * endwhile
+ *
+ * end
+ * @enduml
+ */
+void Dio_ExtiInit(const Dio_ExtiChannelConfigType *ConfigPtr) {
+	uint8 Index;
+	uint8 Line;
+	uint8 Irq;
+	uint32 LineMask;
+	uint32 Shift;
+	uint32 InterruptState;
+
+	if (NULL_PTR == ConfigPtr) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_EXTI_INIT_SID,
+		DIO_E_PARAM_CONFIG);
+		return;
+	}
+
+	/*a new init replaces the channels of the previous one, their lines are free again*/
+	ENTER_CRITICAL_SECTION(InterruptState);
+	for (Line = 0; Line < DIO_EXTI_NUM_OF_LINES; Line++) {
+		if (Dio_ExtiLines[Line] != NULL_PTR) {
+			EXTI->IMR &= ~((uint32) 1U << Line);
+			Dio_ExtiLines[Line] = NULL_PTR;
+		}
+	}
+	EXIT_CRITICAL_SECTION(InterruptState);
+
+	SET_BIT(RCC_APB2ENR, RCC_APB2ENR_AFIOEN);
+
+	for (Index = 0; Index < DIO_EXTI_CONFIGURED_CHANNELS; Index++) {
+		Line = (uint8) DIO_CHANNEL_PIN(ConfigPtr[Index].ChannelId);
+		if (((uint32) ConfigPtr[Index].ChannelId >= NUM_OF_PINS)
+				|| (Dio_ExtiLines[Line] != NULL_PTR)) {
+			Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_EXTI_INIT_SID,
+			DIO_E_PARAM_CONFIG);
+			continue;
+		}
+		LineMask = (uint32) 1U << Line;
+		Shift = (uint32) (Line & 0x03U) * 4U;
+
+		/*EXTI line n takes pin n of the port written in its EXTICR nibble*/
+		AFIO->EXTICR[Line >> 2] = (AFIO->EXTICR[Line >> 2] & ~((uint32) 0x0FU << Shift))
+				| (DIO_CHANNEL_PORT(ConfigPtr[Index].ChannelId) << Shift);
+
+		if (ConfigPtr[Index].Edge & DIO_EXTI_RISING_EDGE) {
+			EXTI->RTSR |= LineMask;
+		} else {
+			EXTI->RTSR &= ~LineMask;
+		}
+		if (ConfigPtr[Index].Edge & DIO_EXTI_FALLING_EDGE) {
+			EXTI->FTSR |= LineMask;
+		} else {
+			EXTI->FTSR &= ~LineMask;
+		}
+
+		Dio_ExtiLines[Line] = &ConfigPtr[Index];
+		EXTI->PR = LineMask;
+		EXTI->IMR |= LineMask;
+
+		Irq = Dio_ExtiLineIrq(Line);
+		NVIC_ISER[Irq >> 5] = (uint32) 1U << (Irq & 0x1FU);
+	}
+}
+
+/**
+ * \section Service_Name
+ * Dio_ExtiReadEvent
+ *
+ * \section Description
+ * Function to take the oldest edge event out of the FIFO
+ * \section Req_ID
+ * Dio_0x11
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] EventPtr \Hold the event
+ * \return Std_ReturnType
+ *
+ * @startuml
+ * start
+ *
+ * if (EventPtr is NULL) then (yes)
+ * :Report Error;
+ * :return E_NOT_OK;
+ * elseif (Head == Tail) then (yes)
+ * :return E_NOT_OK;
+ * else (no)
+ * :copy the event at Tail;
+ * :Tail++;
+ * :return E_OK;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+Std_ReturnType Dio_ExtiReadEvent(Dio_ExtiEventType *EventPtr) {
+	uint8 Tail = Dio_ExtiFifoTail;
+
+	if (NULL_PTR == EventPtr) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_EXTI_READ_EVENT_SID,
+		DIO_E_PARAM_POINTER);
+		return E_NOT_OK;
+	}
+	if (Tail == Dio_ExtiFifoHead) {
+		return E_NOT_OK;
+	}
+	EventPtr->ChannelId = Dio_ExtiFifo[Tail & (DIO_EXTI_FIFO_SIZE - 1)].ChannelId;
+	EventPtr->Level = Dio_ExtiFifo[Tail & (DIO_EXTI_FIFO_SIZE - 1)].Level;
+	EventPtr->Timestamp = Dio_ExtiFifo[Tail & (DIO_EXTI_FIFO_SIZE - 1)].Timestamp;
+	/*the slot is given back to the handlers after the copy*/
+	Dio_ExtiFifoTail = (uint8) (Tail + 1U);
+	return E_OK;
+}
+
+/**
+ * \section Service_Name
+ * Dio_ExtiGetOverflowCount
+ *
+ * \section Description
+ * Function to get the number of events dropped on a full FIFO
+ * \section Req_ID
+ * Dio_0x12
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return uint32
+ *
+ * @startuml
+ * start
+ * :return the overflow count;
+ * end
+ * @enduml
+ */
+uint32 Dio_ExtiGetOverflowCount(void) {
+	return Dio_ExtiOverflowCount;
+}
+
+/*====================================================================================*/
+
+void EXTI0_IRQHandler(void) {
+	Dio_ExtiProcess((uint32) 1U << 0);
+}
+
+void EXTI1_IRQHandler(void) {
+	Dio_ExtiProcess((uint32) 1U << 1);
+}
+
+void EXTI2_IRQHandler(void) {
+	Dio_ExtiProcess((uint32) 1U << 2);
+}
+
+void EXTI3_IRQHandler(void) {
+	Dio_ExtiProcess((uint32) 1U << 3);
+}
+
+void EXTI4_IRQHandler(void) {
+	Dio_ExtiProcess((uint32) 1U << 4);
+}
+
+void EXTI9_5_IRQHandler(void) {
+	Dio_ExtiProcess(DIO_EXTI9_5_LINES);
+}
+
+void EXTI15_10_IRQHandler(void) {
+	Dio_ExtiProcess(DIO_EXTI15_10_LINES);
+}
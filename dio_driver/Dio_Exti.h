@@ -0,0 +1,176 @@
+/**
+ *@file       Dio_Exti.h
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio External Interrupt Header File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+#ifndef DIO_EXTI_H_
+#define DIO_EXTI_H_
+
+/*============================================================================*/
+/**
+* \file Dio_Exti.h
+*
+* @section Introduction
+*
+* Edge detection of DIO channels on the EXTI lines of the STM32F103. EXTI line n
+* serves pin n of one port, so a configuration holds at most one channel of
+* each pin number. On an edge the interrupt handler takes a Systick_GetTimestamp
+* timestamp, calls the channel notification and queues the event in a FIFO
+* read by the application with Dio_ExtiReadEvent.
+*
+* The channels must be configured as inputs by the Port driver.
+*
+*
+* \section Scope
+* Public
+*
+*/
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio.h"
+
+/*******************************************************************************
+ *                      API Service Id Macros                                  *
+ *******************************************************************************/
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x18
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO EXTI init */
+#define DIO_EXTI_INIT_SID              (uint8)0x18
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x19
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO EXTI read event */
+#define DIO_EXTI_READ_EVENT_SID        (uint8)0x19
+
+/* EXTI lines, one per pin number */
+#define DIO_EXTI_NUM_OF_LINES          (16U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/**
+  * @brief Enumeration for the edges detected on a channel.
+  *
+  *
+  * @details
+  * - Type: enum
+  * - Range: 1:3
+  * - Resolution: 1U
+  * - Unit: Bits
+  */
+
+typedef enum {
+	DIO_EXTI_RISING_EDGE = 1, DIO_EXTI_FALLING_EDGE = 2, DIO_EXTI_BOTH_EDGES = 3
+} Dio_ExtiEdgeType;
+
+/**
+  * @brief Structure for one detected edge.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - ChannelId : channel of the edge
+  * - Level     : level of the channel read in the interrupt handler
+  * - Timestamp : Systick_GetTimestamp in the interrupt handler
+  */
+
+typedef struct {
+	Dio_ChannelType ChannelId;
+	Dio_LevelType Level;
+	uint32 Timestamp;
+} Dio_ExtiEventType;
+
+/* Notification called from the interrupt handler for each edge */
+typedef void (*Dio_ExtiNotificationType)(const Dio_ExtiEventType *EventPtr);
+
+/**
+  * @brief Structure for the configuration of one channel.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - ChannelId    : channel to detect the edges of
+  * - Edge         : edges to detect
+  * - Notification : called from the interrupt handler, NULL_PTR for none
+  */
+
+typedef struct {
+	Dio_ChannelType ChannelId;
+	Dio_ExtiEdgeType Edge;
+	Dio_ExtiNotificationType Notification;
+} Dio_ExtiChannelConfigType;
+
+/* Channels of the configuration declared in Dio_LCfg.c */
+extern const Dio_ExtiChannelConfigType Dio_ExtiChannels[DIO_EXTI_CONFIGURED_CHANNELS];
+
+/****************************************************************************
+ ********************* Function definitions **********************************
+ *****************************************************************************/
+
+/**
+ *
+ * This function routes the EXTI lines of the configured channels to their
+ * ports, selects their edges and enables their interrupts.
+ *
+ * @param[in]     ConfigPtr     Type Dio_ExtiChannelConfigType*  Array of DIO_EXTI_CONFIGURED_CHANNELS
+ * @return    none
+ */
+void Dio_ExtiInit(const Dio_ExtiChannelConfigType *ConfigPtr);
+/**
+ *
+ * This function takes the oldest event out of the FIFO.
+ *
+ * @param[out]    EventPtr      Type Dio_ExtiEventType*
+ * @return    Std_ReturnType  E_OK with an event, E_NOT_OK when the FIFO is empty
+ */
+Std_ReturnType Dio_ExtiReadEvent(Dio_ExtiEventType *EventPtr);
+/**
+ *
+ * This function returns the number of events lost because the FIFO was full.
+ *
+ * @return    uint32
+ */
+uint32 Dio_ExtiGetOverflowCount(void);
+
+/* Interrupt handlers of the EXTI lines */
+void EXTI0_IRQHandler(void);
+void EXTI1_IRQHandler(void);
+void EXTI2_IRQHandler(void);
+void EXTI3_IRQHandler(void);
+void EXTI4_IRQHandler(void);
+void EXTI9_5_IRQHandler(void);
+void EXTI15_10_IRQHandler(void);
+
+#endif /* DIO_EXTI_H_ */
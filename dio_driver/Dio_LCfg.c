@@ -20,32 +20,67 @@
 *****************************************************************************/
 
 #include "Dio.h"
+#include "Dio_Debounce.h"
+#include "Dio_Exti.h"
+#include "Dio_SoftPwm.h"
 
+/* PB8..PB15 drive the 8-bit parallel bus */
+#ifdef DIO_HOST_SIMULATION
+/* Register file standing for GPIOA, GPIOB and GPIOC in a host build */
+volatile GPIO_REG Dio_SimulatedPorts[NUM_OF_PORTS];
+volatile EXTI_REG Dio_SimulatedExti;
+volatile AFIO_REG Dio_SimulatedAfio;
+volatile uint32 Dio_SimulatedRccApb2enr;
+volatile uint32 Dio_SimulatedNvicIser[2];
+volatile uint32 Dio_SimulatedBsrrStores[NUM_OF_PORTS];
+#endif
 
-void Dio_SetPinValue(GPIO_REG *gpio_ptr, Dio_ChannelType ChannelId,
+const Dio_ChannelGroupType Dio_ChannelGroups[DIO_CONFIGURED_GROUPS] = {
+	{ 0xFF00, 8, PORTB }
+};
+
+/* PB0 pulse input, both edges queued, no notification */
+const Dio_ExtiChannelConfigType Dio_ExtiChannels[DIO_EXTI_CONFIGURED_CHANNELS] = {
+	{ B0, DIO_EXTI_BOTH_EDGES, NULL_PTR }
+};
+
+/* Channels of the software PWM, sized by the list: a list not matching
+ * DIO_SOFT_PWM_CONFIGURED_CHANNELS conflicts with the declaration of Dio_SoftPwm.h */
+const Dio_ChannelType Dio_SoftPwmChannels[] = {
+	DIO_SOFT_PWM_CHANNEL_LIST
+};
+
+/* PA0 push button, no edge notification */
+const Dio_DebounceConfigType Dio_DebounceConfiguration = {
+	{ 0x0001, 0x0000, 0x0000 },
+	NULL_PTR
+};
+
+void Dio_SetPinValue(volatile GPIO_REG *gpio_ptr, Dio_ChannelType ChannelId,
 		Dio_LevelType Level) {
 	if (Level == STD_LOW) {
 		/*turn off the level of the pin*/
 		gpio_ptr->BRR = (1 << ChannelId);
 	} else {
 		/*turn on the level of the pin*/
-		gpio_ptr->BSRR = (1 << ChannelId);
+		GPIO_BSRR_WRITE(gpio_ptr, 1 << ChannelId);
 	}
 }
-void Dio_TogglePin(GPIO_REG *gpio_ptr, Dio_ChannelType ChannelId) {
-	// check if the pin is in the lower pins (0 to 7)
-	TOGGLE_BIT(gpio_ptr->ODR, ChannelId);
+Dio_LevelType Dio_TogglePin(volatile GPIO_REG *gpio_ptr, Dio_ChannelType ChannelId) {
+	/*a single read of the output level, the write goes through BSRR so the
+	 *other pins of the port are never written back with a stale value*/
+	uint32 Level = (gpio_ptr->ODR >> ChannelId) & STD_HIGH;
+	/*a set pin goes to the reset half (bits 16..31), a cleared pin to the set half*/
+	GPIO_BSRR_WRITE(gpio_ptr, ((uint32) 1 << ChannelId) << (Level << 4));
+	/*returns the level of the pin after toggling*/
+	return (Dio_LevelType) (Level ^ STD_HIGH);
 }
 
-void Dio_SetPortValue(GPIO_REG *gpio_ptr, Dio_LevelType Level) {
-
-	if (Level == STD_LOW) {
-		/*turn off the level of the pin*/
-		gpio_ptr->ODR = STD_PORTLOW;
-	} else {
-		/*turn on the level of the pin*/
-		gpio_ptr->ODR = STD_PORTHIGH;
-	}
+void Dio_SetPortValue(volatile GPIO_REG *gpio_ptr, Dio_PortLevelType Level,
+		Dio_PortLevelType Mask) {
+	/*the pins to turn on in the set half, the pins to turn off in the reset
+	 *half: the whole port changes in one store and the pins out of Mask are untouched*/
+	GPIO_BSRR_WRITE(gpio_ptr, DIO_BSRR_VALUE(Level, Mask));
 }
 
 
@@ -0,0 +1,275 @@
+/**
+ *@file       Dio_Pattern.c
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio Pattern Player Program File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio_Pattern.h"
+#include "Det.h"
+
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+/*the steps are BSRR stores at the tick, a shadow write of the same pin would undo them at the next commit*/
+#error "Dio_Pattern writes its pins at the tick, it can not be built with DIO_SHADOW_OUTPUT STD_ON"
+#endif
+
+/*====================================================================================*/
+
+/* Pattern playing, NULL_PTR when idle; only changed by the tick and Dio_PatternStop */
+static const Dio_PatternType *volatile Dio_PatternCurrent = NULL_PTR;
+
+/* Pattern queued by Dio_PatternLoad, taken by the tick */
+static const Dio_PatternType *volatile Dio_PatternNext = NULL_PTR;
+
+/* Next step of the current pattern and the ticks left before it */
+static uint16 Dio_PatternIndex = 0;
+static uint16 Dio_PatternDelay = 0;
+
+/*====================================================================================*/
+
+/**
+ * \section Service_Name
+ * Dio_PatternLoad
+ *
+ * \section Description
+ * Function to queue a pattern behind the one playing
+ * \section Req_ID
+ * Dio_0x13
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Asynchronous
+ *
+ * \param[in] PatternPtr \Hold the steps of the pattern
+ * \param[inout] None
+ * \param[out] None
+ * \return Std_ReturnType
+ *
+ * @startuml
+ * start
+ *
+ * if (pattern or one of its steps invalid) then (yes)
+ * :Report Error;
+ * :return E_NOT_OK;
+ * else (no)
+ * :Next = PatternPtr;
+ * :return E_OK;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+Std_ReturnType Dio_PatternLoad(const Dio_PatternType *PatternPtr) {
+	uint16 Step;
+
+	if ((NULL_PTR == PatternPtr) || (NULL_PTR == PatternPtr->Steps)) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PATTERN_LOAD_SID,
+		DIO_E_PARAM_POINTER);
+		return E_NOT_OK;
+	}
+	if (PatternPtr->NumOfSteps == 0) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PATTERN_LOAD_SID,
+		DIO_E_PARAM_CONFIG);
+		return E_NOT_OK;
+	}
+	/*the tick writes the steps without any check*/
+	for (Step = 0; Step < PatternPtr->NumOfSteps; Step++) {
+		if ((uint32) PatternPtr->Steps[Step].Port >= NUM_OF_PORTS) {
+			Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PATTERN_LOAD_SID,
+			DIO_E_PARAM_INVALID_PORT_ID);
+			return E_NOT_OK;
+		}
+	}
+	/*a single pointer store, the playing pattern is not touched*/
+	Dio_PatternNext = PatternPtr;
+	return E_OK;
+}
+
+/**
+ * \section Service_Name
+ * Dio_PatternStop
+ *
+ * \section Description
+ * Function to stop the player and drop the queued pattern
+ * \section Req_ID
+ * Dio_0x14
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ * :Mask interrupts;
+ * :Next = NULL, Current = NULL, Delay = 0;
+ * :Restore interrupts;
+ * end
+ * @enduml
+ */
+void Dio_PatternStop(void) {
+	uint32 InterruptState;
+
+	ENTER_CRITICAL_SECTION(InterruptState);
+	Dio_PatternNext = NULL_PTR;
+	Dio_PatternCurrent = NULL_PTR;
+	Dio_PatternDelay = 0;
+	EXIT_CRITICAL_SECTION(InterruptState);
+}
+
+/**
+ * \section Service_Name
+ * Dio_PatternIsBusy
+ *
+ * \section Description
+ * Function to tell whether a pattern is playing or queued
+ * \section Req_ID
+ * Dio_0x15
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return boolean
+ *
+ * @startuml
+ * start
+ * :return Current or Next is set;
+ * end
+ * @enduml
+ */
+boolean Dio_PatternIsBusy(void) {
+	return ((Dio_PatternCurrent != NULL_PTR) || (Dio_PatternNext != NULL_PTR)) ?
+			TRUE : FALSE;
+}
+
+/**
+ * \section Service_Name
+ * Dio_PatternTick
+ *
+ * \section Description
+ * Function to play the patterns, the steps due at this tick are written with
+ * one BSRR store each
+ * \section Req_ID
+ * Dio_0x16
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] Context \Unused, matches Systick_NotificationType
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (Delay > 0) then (yes)
+ * :Delay--;
+ * stop
+ * endif
+ * repeat
+ * if (end of the current pass or idle) then (yes)
+ * if (a pattern is queued) then (yes)
+ * :Current = Next, Next = NULL;
+ * elseif (Current loops) then (yes)
+ * :restart the current pattern;
+ * else (no)
+ * :Current = NULL;
+ * stop
+ * endif
+ * endif
+ * :BSRR of the step port = step value;
+ * :Delay = step delay;
+ * repeat while (Delay == 0 and steps left in this tick?)
+ * :Delay--;
+ *
+ * end
+ * @enduml
+ */
+void Dio_PatternTick(void *Context) {
+	const Dio_PatternType *Pattern = Dio_PatternCurrent;
+	const Dio_PatternStepType *Step;
+	uint32 InterruptState;
+	uint16 Budget;
+
+	(void) Context;
+
+	if (Dio_PatternDelay > 0) {
+		Dio_PatternDelay--;
+		return;
+	}
+
+	/*a pattern with no delay at all plays one pass per tick*/
+	Budget = (Pattern != NULL_PTR) ? Pattern->NumOfSteps : 0;
+	do {
+		if ((Pattern == NULL_PTR) || (Dio_PatternIndex >= Pattern->NumOfSteps)) {
+			/*take the queued pattern at the pass boundary*/
+			ENTER_CRITICAL_SECTION(InterruptState);
+			if (Dio_PatternNext != NULL_PTR) {
+				Pattern = Dio_PatternNext;
+				Dio_PatternNext = NULL_PTR;
+				Budget = Pattern->NumOfSteps;
+			} else if ((Pattern == NULL_PTR) || (Pattern->Loop == FALSE)) {
+				Pattern = NULL_PTR;
+			}
+			Dio_PatternCurrent = Pattern;
+			EXIT_CRITICAL_SECTION(InterruptState);
+			if (Pattern == NULL_PTR) {
+				return;
+			}
+			Dio_PatternIndex = 0;
+		}
+		Step = &Pattern->Steps[Dio_PatternIndex];
+		GPIO_BSRR_WRITE(GPIO_PORT(Step->Port), Step->Bsrr);
+		Dio_PatternDelay = Step->DelayTicks;
+		Dio_PatternIndex++;
+		Budget--;
+	} while ((Dio_PatternDelay == 0) && (Budget > 0));
+
+	/*this tick is the first one of the delay*/
+	if (Dio_PatternDelay > 0) {
+		Dio_PatternDelay--;
+	}
+}
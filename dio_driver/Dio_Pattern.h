@@ -0,0 +1,142 @@
+/**
+ *@file       Dio_Pattern.h
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio Pattern Player Header File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+#ifndef DIO_PATTERN_H_
+#define DIO_PATTERN_H_
+
+/*============================================================================*/
+/**
+* \file Dio_Pattern.h
+*
+* @section Introduction
+*
+* Replays precomputed output patterns from a timer interrupt. A pattern is a
+* table of steps, each step is one BSRR store on one port followed by a delay
+* in ticks; a delay of 0 runs the next step in the same tick, so several ports
+* can change together.
+*
+* The player is double-buffered: Dio_PatternLoad queues the next pattern while
+* the current one plays and the switch happens at the end of the current pass.
+*
+* Dio_PatternTick has the signature of a SysTick notification, the tick is
+* started with Systick_StartTimerWithCallback(Period, Dio_PatternTick, NULL_PTR)
+* while the Systick channel is in SYSTICK_PERIODIC_INTERVAL mode.
+*
+*
+* \section Scope
+* Public
+*
+*/
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio.h"
+
+/*******************************************************************************
+ *                      API Service Id Macros                                  *
+ *******************************************************************************/
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x1A
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO pattern load */
+#define DIO_PATTERN_LOAD_SID           (uint8)0x1A
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/**
+  * @brief Structure for one step of a pattern.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - Port       : port written by the step
+  * - Bsrr       : value stored to BSRR, set bits low half / reset bits high half
+  * - DelayTicks : ticks until the next step, 0 for the same tick
+  */
+
+typedef struct {
+	Dio_PortType Port;
+	uint32 Bsrr;
+	uint16 DelayTicks;
+} Dio_PatternStepType;
+
+/**
+  * @brief Structure for a pattern.
+  *
+  *
+  * @details
+  * - Type: struct
+  * - Steps      : table of the steps
+  * - NumOfSteps : number of steps in the table
+  * - Loop       : TRUE to replay the pattern until an other one is loaded
+  */
+
+typedef struct {
+	const Dio_PatternStepType *Steps;
+	uint16 NumOfSteps;
+	boolean Loop;
+} Dio_PatternType;
+
+/****************************************************************************
+ ********************* Function definitions **********************************
+ *****************************************************************************/
+
+/**
+ *
+ * This function queues a pattern, it starts at the next tick when the player
+ * is idle or at the end of the current pass. A pattern queued earlier and not
+ * started yet is replaced.
+ *
+ * @param[in]     PatternPtr    Type Dio_PatternType*
+ * @return    Std_ReturnType  E_OK when queued
+ */
+Std_ReturnType Dio_PatternLoad(const Dio_PatternType *PatternPtr);
+/**
+ *
+ * This function stops the player and drops the queued pattern, the outputs
+ * keep their last level.
+ *
+ * @return    none
+ */
+void Dio_PatternStop(void);
+/**
+ *
+ * This function tells whether a pattern is playing or queued.
+ *
+ * @return    boolean  TRUE when busy
+ */
+boolean Dio_PatternIsBusy(void);
+/**
+ *
+ * This function plays the patterns, to be called periodically.
+ *
+ * @param[in]     Context       Unused, the tick is a SysTick notification
+ * @return    none
+ */
+void Dio_PatternTick(void *Context);
+
+#endif /* DIO_PATTERN_H_ */
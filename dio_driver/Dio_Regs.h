@@ -39,6 +39,9 @@
 #define GPIOB_BASE_ADDRESS		0x40010C00
 #define GPIOC_BASE_ADDRESS		0x40011000
 
+/*Distance between the register blocks of two following ports*/
+#define GPIO_PORT_STRIDE		0x400
+
 
 
  /**
@@ -62,7 +65,118 @@ typedef struct {
 	uint32 LCK;
 } GPIO_REG;
 
+/*Base Addresses of the external interrupt controller, the alternate function
+ *block (EXTI line to port selection) and the APB2 clock enable register*/
+#define EXTI_BASE_ADDRESS		0x40010400
+#define AFIO_BASE_ADDRESS		0x40010000
+#define RCC_APB2ENR_ADDRESS		0x40021018
+#define NVIC_ISER_ADDRESS		0xE000E100
+
+/*AFIO clock enable bit of RCC_APB2ENR*/
+#define RCC_APB2ENR_AFIOEN		0
+
+ /**
+  * \section Brief
+  * Structure used in a pointer that helps access registers in the EXTI peripheral.
+  *
+  * \section Details
+  * - Type: Structure
+  * - Range: 0x40010400 : 0x40010414
+  * - Resolution: uint32
+  * - Unit: Address
+  */
+typedef struct {
+	uint32 IMR;
+	uint32 EMR;
+	uint32 RTSR;
+	uint32 FTSR;
+	uint32 SWIER;
+	uint32 PR;
+} EXTI_REG;
+
+ /**
+  * \section Brief
+  * Structure used in a pointer that helps access registers in the AFIO peripheral.
+  *
+  * \section Details
+  * - Type: Structure
+  * - Range: 0x40010000 : 0x40010014
+  * - Resolution: uint32
+  * - Unit: Address
+  */
+typedef struct {
+	uint32 EVCR;
+	uint32 MAPR;
+	uint32 EXTICR[4];
+} AFIO_REG;
+
+#ifndef DIO_HOST_SIMULATION
+
+#define EXTI           ((volatile EXTI_REG *)  (EXTI_BASE_ADDRESS))
+#define AFIO           ((volatile AFIO_REG *)  (AFIO_BASE_ADDRESS))
+#define RCC_APB2ENR    (*(volatile uint32 *)   (RCC_APB2ENR_ADDRESS))
+#define NVIC_ISER      ((volatile uint32 *)    (NVIC_ISER_ADDRESS))
+
 #define GPIOA          ((volatile GPIO_REG *)  (GPIOA_BASE_ADDRESS))
 #define GPIOB          ((volatile GPIO_REG *)  (GPIOB_BASE_ADDRESS))
 #define GPIOC          ((volatile GPIO_REG *)  (GPIOC_BASE_ADDRESS))
+
+/*Registers of the port with index PORT_INDEX (0 = GPIOA, 1 = GPIOB, 2 = GPIOC)*/
+#define GPIO_PORT(PORT_INDEX)  ((volatile GPIO_REG *)  (GPIOA_BASE_ADDRESS + ((uint32)(PORT_INDEX) * GPIO_PORT_STRIDE)))
+
+/****************************************************************************
+************************  Bit-band alias   **********************************
+*****************************************************************************/
+
+/*Peripheral region and its bit-band alias region of the Cortex-M3*/
+#define PERIPH_BASE_ADDRESS			0x40000000
+#define PERIPH_BITBAND_BASE_ADDRESS	0x42000000
+
+/*
+ * Word of the alias region mapped on bit BIT of the peripheral register REG:
+ * 0x42000000 + (address - 0x40000000) * 32 + BIT * 4. For a constant channel
+ * the address folds at compile time and the access is a single load/store.
+ */
+#define GPIO_BITBAND_ALIAS(REG, BIT)	(*(volatile uint32 *) (PERIPH_BITBAND_BASE_ADDRESS \
+		+ (((uint32) &(REG) - PERIPH_BASE_ADDRESS) * 32U) + ((uint32)(BIT) * 4U)))
+#define GPIO_BITBAND_READ(REG, BIT)				GPIO_BITBAND_ALIAS(REG, BIT)
+#define GPIO_BITBAND_WRITE(REG, BIT, VALUE)		(GPIO_BITBAND_ALIAS(REG, BIT) = (uint32)(VALUE))
+
+/*Single store to the BSRR of the port registers REGS*/
+#define GPIO_BSRR_WRITE(REGS, VALUE)			((REGS)->BSRR = (uint32)(VALUE))
+
+#else
+
+/*
+ * Host build: the ports, EXTI, AFIO and the clock / interrupt enable registers
+ * are a simulated register file (defined in Dio_LCfg.c)
+ * and a bit-band access is the read / single bit update of the simulated
+ * register it aliases. BSRR and BRR writes are stored, not applied to ODR,
+ * and the BSRR stores of each port are counted in Dio_SimulatedBsrrStores.
+ */
+extern volatile GPIO_REG Dio_SimulatedPorts[];
+extern volatile EXTI_REG Dio_SimulatedExti;
+extern volatile AFIO_REG Dio_SimulatedAfio;
+extern volatile uint32 Dio_SimulatedRccApb2enr;
+extern volatile uint32 Dio_SimulatedNvicIser[];
+extern volatile uint32 Dio_SimulatedBsrrStores[];
+
+#define EXTI           (&Dio_SimulatedExti)
+#define AFIO           (&Dio_SimulatedAfio)
+#define RCC_APB2ENR    (Dio_SimulatedRccApb2enr)
+#define NVIC_ISER      (Dio_SimulatedNvicIser)
+
+#define GPIOA          (&Dio_SimulatedPorts[0])
+#define GPIOB          (&Dio_SimulatedPorts[1])
+#define GPIOC          (&Dio_SimulatedPorts[2])
+
+#define GPIO_PORT(PORT_INDEX)  (&Dio_SimulatedPorts[(PORT_INDEX)])
+
+#define GPIO_BITBAND_READ(REG, BIT)				(((REG) >> (BIT)) & 1U)
+#define GPIO_BITBAND_WRITE(REG, BIT, VALUE)		((REG) = ((REG) & ~((uint32) 1U << (BIT))) \
+		| (((uint32)(VALUE) & 1U) << (BIT)))
+#define GPIO_BSRR_WRITE(REGS, VALUE)			((REGS)->BSRR = (uint32)(VALUE), \
+		Dio_SimulatedBsrrStores[(REGS) - Dio_SimulatedPorts]++)
+
+#endif /* DIO_HOST_SIMULATION */
 #endif
@@ -0,0 +1,317 @@
+/**
+ *@file       Dio_SoftPwm.c
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio Software PWM Program File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio_SoftPwm.h"
+#include "Det.h"
+
+#if (DIO_SHADOW_OUTPUT == STD_ON)
+/*the edges are BSRR stores at the tick, a shadow write of the same pin would undo them at the next commit*/
+#error "Dio_SoftPwm writes its pins at the tick, it can not be built with DIO_SHADOW_OUTPUT STD_ON"
+#endif
+
+/*====================================================================================*/
+
+/* Switch off of the channels of one port at one tick */
+typedef struct {
+	uint8 Tick;
+	uint8 Port;
+	uint16 Mask;
+} Dio_SoftPwmEdgeType;
+
+/* What the PWM writes during one period */
+typedef struct {
+	uint32 StartBsrr[NUM_OF_PORTS];
+	Dio_SoftPwmEdgeType Edges[DIO_SOFT_PWM_CONFIGURED_CHANNELS];
+	uint8 NumOfEdges;
+} Dio_SoftPwmTableType;
+
+/* Duty of each channel */
+static Dio_SoftPwmDutyType Dio_SoftPwmDuty[DIO_SOFT_PWM_CONFIGURED_CHANNELS];
+
+/* Table played by the tick and the table built for the next period */
+static Dio_SoftPwmTableType Dio_SoftPwmTables[2];
+static volatile uint8 Dio_SoftPwmActive = 0;
+static volatile boolean Dio_SoftPwmNextReady = FALSE;
+
+/* Tick in the period and next edge of the active table */
+static uint8 Dio_SoftPwmPhase = 0;
+static uint8 Dio_SoftPwmEdge = 0;
+
+/*====================================================================================*/
+
+/* Build the table of the current duties in Table */
+static void Dio_SoftPwmBuild(Dio_SoftPwmTableType *Table) {
+	Dio_SoftPwmEdgeType Edge;
+	uint32 Mask;
+	uint8 Channel;
+	uint8 Port;
+	uint8 Count = 0;
+	uint8 i;
+	uint8 j;
+
+	for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+		Table->StartBsrr[Port] = 0;
+	}
+
+	for (Channel = 0; Channel < DIO_SOFT_PWM_CONFIGURED_CHANNELS; Channel++) {
+		if ((uint32) Dio_SoftPwmChannels[Channel] >= NUM_OF_PINS) {
+			/*reported by Dio_SoftPwmInit, never driven*/
+			continue;
+		}
+		Port = (uint8) DIO_CHANNEL_PORT(Dio_SoftPwmChannels[Channel]);
+		Mask = DIO_CHANNEL_MASK(Dio_SoftPwmChannels[Channel]);
+
+		if (Dio_SoftPwmDuty[Channel] == 0) {
+			/*off for the whole period*/
+			Table->StartBsrr[Port] |= Mask << 16;
+			continue;
+		}
+		Table->StartBsrr[Port] |= Mask;
+		if (Dio_SoftPwmDuty[Channel] >= DIO_SOFT_PWM_PERIOD) {
+			/*on for the whole period*/
+			continue;
+		}
+
+		Edge.Tick = Dio_SoftPwmDuty[Channel];
+		Edge.Port = Port;
+		Edge.Mask = (uint16) Mask;
+
+		/*edges sorted by tick then port*/
+		for (i = 0; i < Count; i++) {
+			if ((Table->Edges[i].Tick > Edge.Tick)
+					|| ((Table->Edges[i].Tick == Edge.Tick) && (Table->Edges[i].Port >= Edge.Port))) {
+				break;
+			}
+		}
+		if ((i < Count) && (Table->Edges[i].Tick == Edge.Tick)
+				&& (Table->Edges[i].Port == Edge.Port)) {
+			/*same tick and port: merged so the tick writes the port once*/
+			Table->Edges[i].Mask |= Edge.Mask;
+			continue;
+		}
+		for (j = Count; j > i; j--) {
+			Table->Edges[j] = Table->Edges[j - 1];
+		}
+		Table->Edges[i] = Edge;
+		Count++;
+	}
+	Table->NumOfEdges = Count;
+}
+
+/*
+ * Build the next table from the duties and hand it to the tick. The critical
+ * sections are also compiler barriers: the table is not written before the
+ * tick stops swapping, and it is complete before NextReady is set.
+ */
+static void Dio_SoftPwmPublish(void) {
+	uint32 InterruptState;
+	uint8 Next;
+
+	/*the tick no longer swaps, the table it does not play is free*/
+	ENTER_CRITICAL_SECTION(InterruptState);
+	Dio_SoftPwmNextReady = FALSE;
+	Next = Dio_SoftPwmActive ^ 1U;
+	EXIT_CRITICAL_SECTION(InterruptState);
+
+	Dio_SoftPwmBuild(&Dio_SoftPwmTables[Next]);
+
+	ENTER_CRITICAL_SECTION(InterruptState);
+	Dio_SoftPwmNextReady = TRUE;
+	EXIT_CRITICAL_SECTION(InterruptState);
+}
+
+/*====================================================================================*/
+
+/**
+ * \section Service_Name
+ * Dio_SoftPwmInit
+ *
+ * \section Description
+ * Function to check the channels of Dio_SoftPwmChannels and set every channel
+ * to a duty of 0, an invalid channel is reported and never driven
+ * \section Req_ID
+ * Dio_0x1D
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ * while (more channels?)
+ * if (channel invalid) then (yes)
+ * :Report Error;
+ * endif
+ * :Duty = 0;
+ * endwhile
+ * :build the next table;
+ * end
+ * @enduml
+ */
+void Dio_SoftPwmInit(void) {
+	uint8 Channel;
+
+	for (Channel = 0; Channel < DIO_SOFT_PWM_CONFIGURED_CHANNELS; Channel++) {
+		if ((uint32) Dio_SoftPwmChannels[Channel] >= NUM_OF_PINS) {
+			Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_SOFT_PWM_INIT_SID,
+			DIO_E_PARAM_INVALID_CHANNEL_ID);
+		}
+		Dio_SoftPwmDuty[Channel] = 0;
+	}
+	Dio_SoftPwmPublish();
+}
+
+/**
+ * \section Service_Name
+ * Dio_SoftPwmSetDuty
+ *
+ * \section Description
+ * Function to set the duty of a channel from the next period on. The next
+ * table is shared by every call, so it must not preempt another call of
+ * Dio_SoftPwmSetDuty or Dio_SoftPwmInit (e.g. from an interrupt)
+ * \section Req_ID
+ * Dio_0x1E
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Asynchronous
+ *
+ * \param[in] Channel \Hold the index of the channel in Dio_SoftPwmChannels
+ * \param[in] Duty    \Hold the ticks the channel is on in a period
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (Channel invalid) then (yes)
+ * :Report Error;
+ * else (no)
+ * :save Duty;
+ * :NextReady = FALSE;
+ * :sort the edges of all the channels into the table not played;
+ * :merge the edges of the same tick and port;
+ * :NextReady = TRUE;
+ * endif
+ *
+ * end
+ * @enduml
+ */
+void Dio_SoftPwmSetDuty(Dio_SoftPwmChannelType Channel, Dio_SoftPwmDutyType Duty) {
+	if (Channel >= DIO_SOFT_PWM_CONFIGURED_CHANNELS) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_SOFT_PWM_SET_DUTY_SID,
+		DIO_E_PARAM_INVALID_CHANNEL_ID);
+		return;
+	}
+	Dio_SoftPwmDuty[Channel] = Duty;
+	Dio_SoftPwmPublish();
+}
+
+/**
+ * \section Service_Name
+ * Dio_SoftPwmTick
+ *
+ * \section Description
+ * Function to run one tick of the PWM, at most one BSRR store per port
+ * \section Req_ID
+ * Dio_0x1F
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] Context \Unused, matches Systick_NotificationType
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (Phase == 0) then (yes)
+ * if (NextReady) then (yes)
+ * :swap the tables;
+ * endif
+ * :BSRR of each port = StartBsrr;
+ * endif
+ * while (next edge at Phase?)
+ * :BSRR of the edge port = Mask << 16;
+ * endwhile
+ * :Phase++, back to 0 after a period;
+ *
+ * end
+ * @enduml
+ */
+void Dio_SoftPwmTick(void *Context) {
+	const Dio_SoftPwmTableType *Table;
+	uint8 Port;
+
+	(void) Context;
+
+	if (Dio_SoftPwmPhase == 0) {
+		/*a new setting starts only with a period*/
+		if (Dio_SoftPwmNextReady) {
+			Dio_SoftPwmActive ^= 1U;
+			Dio_SoftPwmNextReady = FALSE;
+		}
+		Table = &Dio_SoftPwmTables[Dio_SoftPwmActive];
+		for (Port = 0; Port < NUM_OF_PORTS; Port++) {
+			if (Table->StartBsrr[Port] != 0) {
+				GPIO_BSRR_WRITE(GPIO_PORT(Port), Table->StartBsrr[Port]);
+			}
+		}
+		Dio_SoftPwmEdge = 0;
+	} else {
+		Table = &Dio_SoftPwmTables[Dio_SoftPwmActive];
+	}
+
+	while ((Dio_SoftPwmEdge < Table->NumOfEdges)
+			&& (Table->Edges[Dio_SoftPwmEdge].Tick == Dio_SoftPwmPhase)) {
+		GPIO_BSRR_WRITE(GPIO_PORT(Table->Edges[Dio_SoftPwmEdge].Port),
+				(uint32) Table->Edges[Dio_SoftPwmEdge].Mask << 16);
+		Dio_SoftPwmEdge++;
+	}
+
+	Dio_SoftPwmPhase++;
+	if (Dio_SoftPwmPhase >= DIO_SOFT_PWM_PERIOD) {
+		Dio_SoftPwmPhase = 0;
+	}
+}
@@ -0,0 +1,136 @@
+/**
+ *@file       Dio_SoftPwm.h
+ *@version    1.0.0
+ *@brief      AUTOSAR Based
+ *@details    Dio Software PWM Header File.
+ *@authors    Ahmed Yassin, Farah Ahmed and Mohamed Mabrouk
+ */
+
+/*===========================================================================
+ *   Project          : AUTOSAR  R22-11 MCAL
+ *   Platform         : ARM
+ *   Peripherial      : STM32F103C8T6
+ *   AUTOSAR Version  : R22-11
+ *   SW Version       : 1.0.0
+ ============================================================================*/
+#ifndef DIO_SOFT_PWM_H_
+#define DIO_SOFT_PWM_H_
+
+/*============================================================================*/
+/**
+* \file Dio_SoftPwm.h
+*
+* @section Introduction
+*
+* 8-bit software PWM on up to 32 DIO channels. A period is DIO_SOFT_PWM_PERIOD
+* ticks of Dio_SoftPwmTick: the first tick switches every channel on (or off
+* for a duty of 0) with one BSRR store per port, then each channel is switched
+* off at the tick equal to its duty. The switch off edges are sorted and the
+* edges of one tick on one port are merged, so a tick never writes a port more
+* than once whatever the number of channels.
+*
+* The edge table is double-buffered: Dio_SoftPwmSetDuty builds the next table
+* and the tick takes it at the start of a period, a period never mixes two
+* settings.
+*
+* Dio_SoftPwmTick has the signature of a SysTick notification. The PWM
+* frequency is 1 / (DIO_SOFT_PWM_PERIOD * tick period), a tick of 40 us gives
+* about 100 Hz; the millisecond ticks of Systick_StartTimerWithCallback are only
+* fit for slow signals.
+*
+*
+* \section Scope
+* Public
+*
+*/
+/****************************************************************************
+ *****************************  Includes   ***********************************
+ *****************************************************************************/
+
+#include "Dio.h"
+
+/*******************************************************************************
+ *                      API Service Id Macros                                  *
+ *******************************************************************************/
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x1D
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO soft PWM set duty */
+#define DIO_SOFT_PWM_SET_DUTY_SID      (uint8)0x1D
+
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x1F
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+
+/* Service ID for DIO soft PWM init */
+#define DIO_SOFT_PWM_INIT_SID          (uint8)0x1F
+
+/* Ticks of a period, a duty of DIO_SOFT_PWM_PERIOD keeps the channel on */
+#define DIO_SOFT_PWM_PERIOD            (255U)
+
+#if (DIO_SOFT_PWM_CONFIGURED_CHANNELS > 32)
+  #error "The software PWM drives at most 32 channels"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Index of a channel in Dio_SoftPwmChannels */
+typedef uint8 Dio_SoftPwmChannelType;
+
+/* Duty cycle in ticks, 0 : always off, DIO_SOFT_PWM_PERIOD : always on */
+typedef uint8 Dio_SoftPwmDutyType;
+
+/* Channels of the configuration declared in Dio_LCfg.c */
+extern const Dio_ChannelType Dio_SoftPwmChannels[DIO_SOFT_PWM_CONFIGURED_CHANNELS];
+
+/****************************************************************************
+ ********************* Function definitions **********************************
+ *****************************************************************************/
+
+/**
+ *
+ * This function checks the channels, sets every channel to a duty of 0 and
+ * starts the table.
+ *
+ * @return    none
+ */
+void Dio_SoftPwmInit(void);
+/**
+ *
+ * This function sets the duty of a channel, it applies from the next period.
+ * Non reentrant: it must not preempt another Dio_SoftPwmSetDuty or
+ * Dio_SoftPwmInit, the tick may preempt it.
+ *
+ * @param[in]     Channel       Type Dio_SoftPwmChannelType  Range 0:DIO_SOFT_PWM_CONFIGURED_CHANNELS-1
+ * @param[in]     Duty          Type Dio_SoftPwmDutyType     Range 0:255
+ * @return    none
+ */
+void Dio_SoftPwmSetDuty(Dio_SoftPwmChannelType Channel, Dio_SoftPwmDutyType Duty);
+/**
+ *
+ * This function runs one tick of the PWM, to be called periodically.
+ *
+ * @param[in]     Context       Unused, the tick is a SysTick notification
+ * @return    none
+ */
+void Dio_SoftPwmTick(void *Context);
+
+#endif /* DIO_SOFT_PWM_H_ */
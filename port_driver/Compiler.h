@@ -51,4 +51,17 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/*
+ * Exclusive area: save PRIMASK into STATE and mask interrupts, then restore it.
+ * Keep the protected section to a few instructions, nesting is allowed.
+ */
+#if defined(__GNUC__) && defined(__arm__)
+#define ENTER_CRITICAL_SECTION(STATE)   __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (STATE) : : "memory")
+#define EXIT_CRITICAL_SECTION(STATE)    __asm volatile ("msr primask, %0" : : "r" (STATE) : "memory")
+#elif !defined(ENTER_CRITICAL_SECTION)
+/* host build: no interrupts to mask unless a simulation provides its own macros */
+#define ENTER_CRITICAL_SECTION(STATE)   ((STATE) = 0U)
+#define EXIT_CRITICAL_SECTION(STATE)    ((void)(STATE))
+#endif
+
 #endif
@@ -6,13 +6,18 @@
  * Date: April 5, 2024
  * 
  * AUTOSAR Version: 3.2.0
- * Target MCU: TIVAC123GH6PM
+ * Target MCU: TIVAC123GH6PM / STM32F103
  ********************************************************************************/
 #include "port_Cfg.h"
 #include "port.h"
+#include "port_private.h"
 #include "Det.h"
 #include "port_regs.h"
 
+/* the probes of this file follow PORT_PROFILING */
+#define PROF_MODULE_PROFILING	PORT_PROFILING
+#include "Prof.h"
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
 #include "Det.h"
@@ -33,6 +38,20 @@
 STATIC const Port_ChannelConfig *ptr = NULL_PTR ;
 /* variable to ensure that the Port_Init is called */
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED ; 
+/* register images computed by Port_Init when the configuration has no precomputed images */
+STATIC Port_PortImageType Port_BuiltImages[PORT_NUMBER_OF_PORTS];
+/* register images written by Port_Init, then by Port_ApplyProfile: the expected content of the registers */
+STATIC const Port_PortImageType *Port_Images = NULL_PTR;
+#if (PORT_PROFILE_API == STD_ON)
+/* register images of Port_Init completed for every configured pin, written by the RUN profile */
+STATIC Port_PortImageType Port_RunImages[PORT_NUMBER_OF_PORTS];
+/* profile the registers hold, Port_RefreshPortDirection only refreshes the RUN directions */
+STATIC Port_ProfileType Port_ActiveProfile = PORT_PROFILE_RUN;
+#endif
+#if (PORT_VERIFY_API == STD_ON)
+/* bits of every register checked by Port_Verify */
+STATIC Port_VerifyMaskType Port_VerifyMasks[PORT_NUMBER_OF_PORTS];
+#endif
 
 /*******************************************************************************
  *                      Function Definition                                     *
@@ -57,188 +76,51 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 	if (NULL_PTR == ConfigPtr)
 	{
      Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_INIT_SID , PORT_E_PARAM_CONFIG);
-
+     return;
 	}
 	else
 	{
 	    /* Do Nothing */
 	}
 #endif
-	{
-
-		Port_Status = PORT_INITIALIZED;
-		ptr = ConfigPtr->arr; /* address of the first element in the array of stuctures to be used outside this function */
-	}
+	ptr = ConfigPtr->arr; /* address of the first element in the array of stuctures to be used outside this function */
 
 	/*------------------------------------------Init of pins-------------------------------------------*/
-	uint8 i ;
-	for(i=0 ; i<PORT_CONFIGURED_PINS ; i++)
+	/* The final content of every register is known first, then each register is written once per port */
+	PROF_START(PROF_PROBE_PORT_INIT);
+	if (ConfigPtr->images != NULL_PTR)
 	{
+		/* register images precomputed with the configuration */
+		Port_Images = ConfigPtr->images;
+	}
+	else
+	{
+		Port_BuildImages(ConfigPtr->arr , Port_BuiltImages);
+		Port_Images = Port_BuiltImages;
+	}
+	Port_WriteImages(Port_Images);
 
-        /* Pointer to the required Port Registers base address */
-            volatile uint32 * PortGpio_Ptr = NULL_PTR;
-
-            /* Get the port number and pin number */
-            uint8 port_num = Port_GetNumber(ConfigPtr->arr[i].pin_id);
-            uint8 pin_num = Pin_GetNumber(port_num ,ConfigPtr->arr[i].pin_id);
-
-            /* Choose the base address register according to the port number */
-            switch (port_num)
-            {
-                case 0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                        break;
-                case 1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                        break;
-                case 2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                        break;
-                case 3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                        break;
-                case 4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                        break;
-                case 5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                        break;
-            }
-
-            /*----------------------------Special handling for certain pins-----------------------------------*/
-
-            if (((port_num == PORTD) && (pin_num == 7)) || ((port_num == PORTF) && (pin_num == 0)))
-            {
-                /* Unlock the GPIOCR register */
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-                /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , pin_num);
-            }
-            else
-            {
-                /* Do Nothing */
-            }
-
-
-          /*------------------------------------------------------------------------------------------------------------*/
-
-            if(ConfigPtr->arr[i].pin_enable == Disable)
-            {
-
-                /*-----------------------configure this pin by the default configuration-------------------------------*/
-
-                /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_num);
-
-                /* Set the corresponding bit in the GPIOPUR register to enable the internal pull-up pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , pin_num);
-
-                /* clear alternative function */
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_num);
-
-                /* Set the Mode configured in the GPIOPCTL register as gpio_mode */
-                uint32 GPIOCTL = *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET);
-                GPIOCTL = ((GPIOCTL) & (0xF0 << pin_num *4 ) ) | ((ConfigPtr->arr[i].mode) << pin_num *4 );
-
-
-            }
-            else if (ConfigPtr->arr[i].pin_enable == Enable)
-            {
-
-                /*------------------this pin is not configured as default configuration-------------------------*/
-                /*---------------------configuration for direction/initial value/resistor type-----------------*/
-                if (ConfigPtr->arr[i].direction == PORT_PIN_OUT)
-                {
-                    /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_num);
-
-                    /* Provide initial value */
-                    if (ConfigPtr->arr[i].initial_value == INITIAL_HIGH)
-                    {
-                        /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-                        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , pin_num);
-                    }
-                    else if (ConfigPtr->arr[i].initial_value == INITIAL_LOW)
-                    {
-                        /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-                        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , pin_num);
-                    }
-                    else
-                    {
-                        /* Do Nothing */
-                    }
-                }
-                else if (ConfigPtr->arr[i].direction== PORT_PIN_IN)
-                {
-                    /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_num);
-
-                    /* Enable internal pull-up or pull-down resistors */
-                    if (ConfigPtr->arr[i].resistor == PULL_UP)
-                    {
-                        /* Set the corresponding bit in the GPIOPUR register to enable the internal pull-up pin */
-                        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , pin_num);
-                    }
-                    else if (ConfigPtr->arr[i].resistor == PULL_DOWN)
-                    {
-                        /* Set the corresponding bit in the GPIOPDR register to enable the internal pull-down pin */
-                        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , pin_num);
-                    }
-                    else
-                    {
-                        /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull-up pin */
-                        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , pin_num);
-                        /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull-down pin */
-                        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , pin_num);
-                    }
-                }
-                else
-                {
-                    /* Do Nothing */
-                }
-                /*---------------------------------------------------------------------------------------------------------*/
-                /*----------------------------------------------------------------------------------------------------------*/
-
-
-                /*-------------------------------------configuration for mode ------------------------------------------*/
-
-                /* Check if Mode is different from Gpio_Mode */
-                if (ConfigPtr->arr[i].mode != Gpio_Mode)
-                {
-                    /* Set alternative function */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_num);
-                }
-                else
-                {
-                    /* clear alternative function */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_num);
-                }
-
-                /*-------------------------------------------------------------------------------------------------------------*/
-
-                /*--------------------------------------Special handling for certain mode-------------------------------------*/
-                if (ConfigPtr->arr[i].mode == ADC_Mode)
-                {
-                    /* Enable analog register */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_num);
-                    /* Disable digital register */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET ) , pin_num);
-                }
-                else
-                {
-                    /* Enable digital register */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET ) , pin_num);
-                    /* Disable analog register */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_num);
-                }
-
-               /*---------------------------------------------------------------------------------------------------------------*/
-
-                /* Set the Mode configured in the GPIOPCTL register */
-                uint32 GPIOCTL = *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET);
-                GPIOCTL = ((GPIOCTL) & (0xF0 << pin_num *4) ) | ((ConfigPtr->arr[i].mode) << pin_num *4 );
-
-
-            }
-
-
+#if (PORT_PROFILE_API == STD_ON)
+	{
+		uint8 port;
+
+		/* the RUN profile returns to this configuration from any other profile */
+		for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+		{
+			Port_RunImages[port] = Port_Images[port];
+		}
+		Port_CompleteImages(ConfigPtr->arr , Port_RunImages);
+		Port_ActiveProfile = PORT_PROFILE_RUN;
 	}
+#endif
 
+#if (PORT_VERIFY_API == STD_ON)
+	Port_BuildVerifyMasks(ConfigPtr->arr , Port_VerifyMasks);
+#endif
 
+	/* the other services are allowed once every register holds the configuration */
+	Port_Status = PORT_INITIALIZED;
+	PROF_STOP(PROF_PROBE_PORT_INIT);
 }
 /************************************************************************************
 * Service Name: Port_SetPinDirection
@@ -260,6 +142,7 @@ void Port_SetPinDirection (Port_PinType Pin , Port_PinDirectionType Direction)
     {
         /* Report error: init function has not been called first */
         Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_DIRECTION_SID , PORT_E_UNINIT);
+        return;
     }
     else
     {
@@ -268,17 +151,20 @@ void Port_SetPinDirection (Port_PinType Pin , Port_PinDirectionType Direction)
 #endif
 
 
-    /* Local variable to hold the configuration index */
-    uint8 copy_localConfigIndex;
-    uint8 i ;
-    /* Search for the pin to be configured*/
-    for (i = 0; i < PORT_CONFIGURED_PINS; i++)
+    /* Local variable to hold the configuration index, looked up directly from the pin index table */
+    uint8 copy_localConfigIndex = Port_GetConfigIndex(Pin);
+
+    if (copy_localConfigIndex == PORT_INVALID_CONFIG_INDEX)
     {
-        if (ptr[i].pin_id == Pin)
-        {
-            copy_localConfigIndex = i;
-            break; // Exit the loop once the index of the passed pin id is found
-        }
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* Report error: the Pin parameter is out of range or not configured */
+        Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_DIRECTION_SID , PORT_E_PARAM_PIN);
+    #endif
+        return;
+    }
+    else
+    {
+        /* Do Nothing */
     }
 
 
@@ -289,17 +175,7 @@ void Port_SetPinDirection (Port_PinType Pin , Port_PinDirectionType Direction)
         {
             /* direction can not be changed during run time */
             Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_DIRECTION_SID ,PORT_E_DIRECTION_UNCHANGEABLE);
-        }
-        else
-        {
-            /* Do Nothing */
-        }
-
-        
-        if (Pin > 38 )
-        {
-        	/* Report error:the Pin parameter is out of range */
-            Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_DIRECTION_SID , PORT_E_PARAM_PIN);
+            return;
         }
         else
         {
@@ -311,66 +187,7 @@ void Port_SetPinDirection (Port_PinType Pin , Port_PinDirectionType Direction)
      /*--------------------------------------------------------------------------------------------------------*/
 
     /*-------------------------No errors detected, proceed with configuring the pin----------------------------*/
-
-    /* Pointer to the required Port Registers base address */
-    volatile uint32 * PortGpio_Ptr = NULL_PTR;
-
-    /* Get the port number and pin number */
-    uint8 port_num = Port_GetNumber(Pin);
-    uint8 pin_num = Pin_GetNumber(port_num , Pin);
-
-    /* Choose the base address register according to the port number */
-    switch (port_num)
-    {
-        case 0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                break;
-        case 1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                break;
-        case 2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                break;
-        case 3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                break;
-        case 4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                break;
-        case 5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                break;
-    }
-
-    /*----------------------------Special handling for certain pins-----------------------------------*/
-
-    if (((port_num == PORTD) && (pin_num == 7)) || ((port_num == PORTF) && (pin_num == 0)))
-    {
-        /* Unlock the GPIOCR register */
-        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-        /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , pin_num);
-    }
-    else
-    {
-
-    }
-
-    /*--------------------------------------------------------------------------------------------------*/
-    
-    /*-----------------------------------------configure the direction-----------------------------------*/
-    if (Direction == PORT_PIN_OUT)
-    {
-        /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_num);
-
-
-    }
-    else if (Direction == PORT_PIN_IN)
-    {
-        /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_num);
-
-    }
-    else
-    {
-        /* Do Nothing */
-    }
-    /*---------------------------------------------------------------------------------------------------------*/
+    Port_WritePinDirection(Pin , Direction);
 }
 #endif
 
@@ -383,7 +200,8 @@ void Port_SetPinDirection (Port_PinType Pin , Port_PinDirectionType Direction)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Refreshes port direction
+* Description: Refreshes port direction. While Port_ApplyProfile holds another profile
+*              than RUN the directions are the ones of that profile and are left as they are.
 ************************************************************************************/
 
 void Port_RefreshPortDirection (void)
@@ -393,6 +211,7 @@ void Port_RefreshPortDirection (void)
     {
         /* Report error: init function has not been called first */
         Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_REFRESH_PORT_DIRECTION_SID , PORT_E_UNINIT);
+        return;
     }
     else
     {
@@ -401,96 +220,38 @@ void Port_RefreshPortDirection (void)
 
 #endif
 
+#if (PORT_PROFILE_API == STD_ON)
+    if (Port_ActiveProfile != PORT_PROFILE_RUN)
+    {
+        /* the SLEEP / SAFE directions are not the configured ones, Port_Verify checks them */
+        return;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+
     /*-----------------------------------refresh the direction of configured pins-----------------------------------------*/
     uint8 i;
     for (i=0 ; i<PORT_CONFIGURED_PINS ; i++)
+    {
+        if(ptr[i].d_ch == STD_ON)
         {
-            if(ptr[i].d_ch == STD_ON)
-            {
-                /* skip this pin don't refresh it */
-                continue;
-
-            }
-            else
-            {
-                /* Do Nothing */
-            }
-            /* Pointer to the required Port Registers base address */
-                volatile uint32 * PortGpio_Ptr = NULL_PTR;
-
-                /* Get the port number and pin number */
-                uint8 port_num = Port_GetNumber(ptr[i].pin_id);
-                uint8 pin_num = Pin_GetNumber(port_num ,ptr[i].pin_id);
-
-                /* Choose the base address register according to the port number */
-                switch (port_num)
-                {
-                    case 0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                            break;
-                    case 1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                            break;
-                    case 2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                            break;
-                    case 3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                            break;
-                    case 4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                            break;
-                    case 5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                            break;
-                }
-
-                /*----------------------------Special handling for certain pins-----------------------------------*/
-
-                if (((port_num == PORTD) && (pin_num == 7)) || ((port_num == PORTF) && (pin_num == 0)))
-                {
-                    /* Unlock the GPIOCR register */
-                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-                    /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-                    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , pin_num);
-                }
-                else
-                {
-                    /* Do Nothing */
-                }
-
-
-
-              /*------------------------------------------------------------------------------------------------------------*/
-
-                if(ptr[i].pin_enable == Disable)
-                {
-                    /* this pin is configured as default configuration */
-                    /* Refresh the direction as default direction -> input */
-
-                    /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_num);
-
-
-                }
-                else if (ptr[i].pin_enable == Enable)
-                {
-
-                    /*------------------this pin is not configured as default configuration-------------------------*/
-                    /*---------------------refresh the direction as configured--------------------------------------*/
-                    if (ptr[i].direction == PORT_PIN_OUT)
-                    {
-                        /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-                        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_num);
-
-                    }
-                    else if (ptr[i].direction== PORT_PIN_IN)
-                    {
-                        /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_num);
-
-                    }
-                    else
-                    {
-                        /* Do Nothing */
-                    }
-                }
-
+            /* skip this pin don't refresh it */
+            continue;
         }
+        else if(ptr[i].pin_enable == Disable)
+        {
+            /* this pin is configured as default configuration, refresh the direction as default direction -> input */
+            Port_WritePinDirection(ptr[i].pin_id , PORT_PIN_IN);
+        }
+        else
+        {
+            /* refresh the direction as configured */
+            Port_WritePinDirection(ptr[i].pin_id , ptr[i].direction);
+        }
+    }
 }
 
 
@@ -554,7 +315,8 @@ void Port_SetPinMode (Port_PinType Pin , Port_PinModeType Mode)
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
         /* Report error: init function has not been called first */
-        Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_DIRECTION_SID , PORT_E_UNINIT);
+        Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_MODE_SID , PORT_E_UNINIT);
+        return;
     }
     else
     {
@@ -562,20 +324,21 @@ void Port_SetPinMode (Port_PinType Pin , Port_PinModeType Mode)
     }
 
 #endif
-    /* Local variable to hold the configuration index */
-    uint8 copy_localConfigIndex;
-    uint8 i ;
+    /* Local variable to hold the configuration index, looked up directly from the pin index table */
+    uint8 copy_localConfigIndex = Port_GetConfigIndex(Pin);
 
-    /* Search for the configuration index corresponding to the given pin */
-    for (i = 0; i < PORT_CONFIGURED_PINS ; i++)
+    if (copy_localConfigIndex == PORT_INVALID_CONFIG_INDEX)
     {
-        if (ptr[i].pin_id == Pin)
-        {
-            copy_localConfigIndex = i;
-            break; // Exit the loop once the index is found
-        }
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* Report error: the pin parameter is out of range or not configured */
+        Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_MODE_SID , PORT_E_PARAM_PIN);
+    #endif
+        return;
+    }
+    else
+    {
+        /* Do Nothing */
     }
-
 
 
     /*------------------------------------------Error detection--------------------------------------------*/
@@ -584,29 +347,20 @@ void Port_SetPinMode (Port_PinType Pin , Port_PinModeType Mode)
 
         if(ptr[copy_localConfigIndex].m_ch == STD_OFF)
         {
-            /* direction can not be changed during run time */
-            Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_DIRECTION_SID ,PORT_E_DIRECTION_UNCHANGEABLE);
+            /* mode can not be changed during run time */
+            Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_MODE_SID ,PORT_E_MODE_UNCHANGEABLE);
+            return;
         }
         else
         {
             /* Do Nothing */
         }
 
-        if ( Mode > 10)
+        if ( Mode > PORT_MAX_MODE)
         {
         	/* Report error: mode is invalid */
             Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_SET_PIN_MODE_SID , PORT_E_PARAM_INVALID_MODE);
-        }
-        else
-        {
-            /* Do Nothing */
-        }
-
-        
-        if (Pin > 38 )
-        {
-        	/* Report error: the pin parameter is out of range */
-            Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID ,  PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+            return;
         }
         else
         {
@@ -616,81 +370,104 @@ void Port_SetPinMode (Port_PinType Pin , Port_PinModeType Mode)
      /*---------------------------------------------------------------------------------------------------------*/
 
     /*-------------------------No errors detected, proceed with configuring the pin-----------------------------*/
+    Port_WritePinMode(Pin , Mode);
+}
+#endif
 
+/************************************************************************************
+* Service Name: Port_Verify
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Repair - TRUE to rewrite the registers that do not match the configuration
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Port_PinMaskType - PORT_PIN_MASK(pin id) set for every corrupted pin
+* Description: Reads back the direction, mode and pull registers of every port once and
+*              compares them with the register images written by Port_Init. The output
+*              levels and the fields of the pins changeable at run time are not checked.
+*              With Repair each wrong register is fixed with a single write.
+*              The pass runs with interrupts masked so that a Port_ApplyProfile called from
+*              an interrupt cannot change the registers and the expected images under it.
+************************************************************************************/
+#if (PORT_VERIFY_API == STD_ON)
+Port_PinMaskType Port_Verify(boolean Repair)
+{
+    Port_PinMaskType corrupted;
+    uint32 InterruptState;
 
-
-    /* Pointer to the required Port Registers base address */
-    volatile uint32 * PortGpio_Ptr = NULL_PTR;
-
-    /* Get the port number and pin number */
-    uint8 port_num = Port_GetNumber(Pin);
-    uint8 pin_num = Pin_GetNumber(port_num , Pin);
-
-    /* Choose the base address register according to the port number */
-    switch (port_num)
-    {
-        case 0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-                break;
-        case 1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-                break;
-        case 2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-                break;
-        case 3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-                break;
-        case 4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-                break;
-        case 5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-                break;
-    }
-
-    /*-----------------------------------Special handling for certain pins-----------------------------------*/
-    if (((port_num == PORTD) && (pin_num == 7)) || ((port_num == PORTF) && (pin_num == 0)))
+    if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        /* Unlock the GPIOCR register */
-        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-        /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , pin_num);
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* Report error: init function has not been called first */
+        Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_VERIFY_SID , PORT_E_UNINIT);
+    #endif
+        return 0;
     }
     else
     {
-
+        /* Do Nothing */
     }
 
+    ENTER_CRITICAL_SECTION(InterruptState);
+    corrupted = Port_VerifyImages(Port_Images , Port_VerifyMasks , Repair);
+    EXIT_CRITICAL_SECTION(InterruptState);
 
-    /* Check if Mode is different from Gpio_Mode */
-    if (Mode != Gpio_Mode)
+    return corrupted;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_ApplyProfile
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Profile - PORT_PROFILE_RUN, PORT_PROFILE_SLEEP or PORT_PROFILE_SAFE
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Switches all pins to a pin profile by writing its precomputed register
+*              images, one write per register. RUN writes the configuration of Port_Init,
+*              or the generated one before Port_Init. It can be called before Port_Init or
+*              from an interrupt to reach the safe state; the images are written with
+*              interrupts masked, so it never interleaves with a Port_Verify repair pass.
+*              A fault handler that PRIMASK does not mask must not call it while
+*              Port_Verify runs.
+************************************************************************************/
+#if (PORT_PROFILE_API == STD_ON)
+void Port_ApplyProfile(Port_ProfileType Profile)
+{
+    const Port_PortImageType *images;
+    uint32 InterruptState;
+
+    if (Profile >= PORT_NUMBER_OF_PROFILES)
     {
-        /* Set alternative function */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_num);
+    #if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* Report error: the profile does not exist */
+        Det_ReportError(PORT_MODULE_ID , PORT_INSTANCE_ID , PORT_APPLY_PROFILE_SID , PORT_E_PARAM_PROFILE);
+    #endif
+        return;
     }
     else
     {
-        /* Clear alternative function */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_num);
+        /* Do Nothing */
     }
 
-    /*-------------------------------------------------------------------------------------------------------------*/
-
-    /*--------------------------------------Special handling for certain mode-------------------------------------*/
-    if (Mode == ADC_Mode)
+    if ((Profile == PORT_PROFILE_RUN) && (Port_Status == PORT_INITIALIZED))
     {
-        /* Enable analog register */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_num);
-        /* Disable digital register */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET ) , pin_num);
+        /* back to the configuration given to Port_Init, not the generated one */
+        images = Port_RunImages;
     }
     else
     {
-        /* Enable digital register */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET ) , pin_num);
-        /* Disable analog register */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_num);
+        images = Port_ProfileImages[Profile];
     }
 
-   /*---------------------------------------------------------------------------------------------------------------*/
-
-    /* Set the Mode configured in the GPIOPCTL register */
-    uint32 GPIOCTL = *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET);
-    GPIOCTL = ((GPIOCTL) & (0xF0 << pin_num *4)) |( Mode << pin_num*4 );
+    ENTER_CRITICAL_SECTION(InterruptState);
+    Port_WriteImages(images);
+    /* the registers are expected to hold the profile from now on (Port_Verify) */
+    Port_Images = images;
+    Port_ActiveProfile = Profile;
+    EXIT_CRITICAL_SECTION(InterruptState);
 }
 #endif
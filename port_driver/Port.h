@@ -6,7 +6,7 @@
  * Date: April 5, 2024
  * 
  * AUTOSAR Version: 3.2.0
- * Target MCU: TIVAC123GH6PM
+ * Target MCU: TIVAC123GH6PM / STM32F103
  **********************************************************************************************/
 
 #ifndef _PORT_H
@@ -14,7 +14,6 @@
 
 #include "std_types.h"
 #include "common_macros.h"
-#include "port_private.h"
 #include "port_Cfg.h"
 
 /* Port vendor ID */
@@ -76,6 +75,10 @@
 #define PORT_GET_VERSION_INFO_SID              (0x03) 
 /* Service ID for setting the mode of a pin. */
 #define PORT_SET_PIN_MODE_SID                  (0x04)   
+/* Service ID for checking the port registers against the configuration. */
+#define PORT_VERIFY_SID                        (0x05)
+/* Service ID for switching all pins to a pin profile. */
+#define PORT_APPLY_PROFILE_SID                 (0x06)
 
 /*******************************************************************************
  *                      DET Error Codes                                        *
@@ -96,10 +99,15 @@
 #define PORT_E_PARAM_POINTER                   (0x0B) 
 /* Invalid initial value of output pin */
 #define PORT_E_PARAM_INITIAL_VALUE             (0x0C) 
+/* Invalid pin profile */
+#define PORT_E_PARAM_PROFILE                   (0x0D)
 
 /*******************************************************************************
  *                              Module Data Types "NON-AUTOSAR"                 *
  *******************************************************************************/
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+
+/* pins PC0..PC3 are used by JTAG and are not part of the pin ids */
 typedef enum
 {
   PA0 , PA1, PA2, PA3, PA4, PA5, PA6, PA7,
@@ -131,6 +139,45 @@ typedef enum
    NMI_Mode = 8,
    ADC_Mode = 10
 }Port_ModeId;
+
+/* Highest valid mode */
+#define PORT_MAX_MODE                   (ADC_Mode)
+
+/* Number of pin id values covered by the pin index table (PA0 .. PF4) */
+#define PORT_PIN_ID_COUNT               (43U)
+
+#elif (PORT_BACKEND == PORT_BACKEND_STM32F103)
+
+/* pin id = port * 16 + pin, the same numbering as the Dio channels,
+ * pins PA13 / PA14 are used by SWD and are not part of the pin ids */
+typedef enum
+{
+  PA0 , PA1, PA2, PA3, PA4, PA5, PA6, PA7, PA8, PA9, PA10, PA11, PA12, PA15 = 15,
+  PB0 = 16, PB1, PB2, PB3, PB4, PB5, PB6, PB7, PB8, PB9, PB10, PB11, PB12, PB13, PB14, PB15 = 31,
+  PC13 = 45, PC14, PC15
+}Port_PinId;
+
+/* CNF[1:0] of a pin, its meaning depends on the pin being an input or an output */
+typedef enum
+{
+   ANALOG_INPUT = 0,
+   FLOATING_INPUT = 1,
+   PULL_INPUT = 2,        /* pull-up or pull-down selected by the resistor of the pin */
+   GP_OPP = 0,            /* general purpose output push-pull */
+   GP_OOD = 1,            /* general purpose output open-drain */
+   AF_OPP = 2,            /* alternate function output push-pull */
+   AF_OOD = 3,            /* alternate function output open-drain */
+   Gpio_Mode = GP_OPP,
+   ADC_Mode = ANALOG_INPUT
+}Port_ModeId;
+
+/* Highest valid mode */
+#define PORT_MAX_MODE                   (AF_OOD)
+
+/* Number of pin id values covered by the pin index table (PA0 .. PC15) */
+#define PORT_PIN_ID_COUNT               (48U)
+
+#endif /* PORT_BACKEND */
  
 typedef enum
 {
@@ -160,11 +207,31 @@ typedef enum
 typedef uint8 Port_PinType;
 typedef uint8 Port_PinModeType; 
 
+/* One bit per pin id, returned by Port_Verify */
+typedef uint64 Port_PinMaskType;
+
+/* Bit of a pin id in a Port_PinMaskType */
+#define PORT_PIN_MASK(PIN)              (((Port_PinMaskType)1U) << (PIN))
+
+/* Pin profile id, PORT_PROFILE_RUN / PORT_PROFILE_SLEEP / PORT_PROFILE_SAFE */
+typedef uint8 Port_ProfileType;
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
 typedef enum
 {
   PORT_PIN_IN, 
   PORT_PIN_OUT
 } Port_PinDirectionType;
+#elif (PORT_BACKEND == PORT_BACKEND_STM32F103)
+/* MODE[1:0] of a pin: input or output with its maximum speed */
+typedef enum
+{
+  PORT_PIN_IN = 0,
+  PORT_PIN_OUT_10MHz = 1,
+  PORT_PIN_OUT_2MHz = 2,
+  PORT_PIN_OUT_50MHz = 3
+} Port_PinDirectionType;
+#endif
 
 
 typedef struct
@@ -181,10 +248,18 @@ typedef struct
 typedef struct 
 {
     Port_ChannelConfig arr[PORT_CONFIGURED_PINS];
+    /* register images of arr precomputed by tools/port_cfg_gen.py, NULL_PTR to compute them in Port_Init */
+    const struct Port_PortImage *images;
 }Port_ConfigType;
 
+/* Pin index table entry of a pin id that has no configuration entry */
+#define PORT_PIN_NOT_CONFIGURED         (0U)
+
 extern const Port_ConfigType Port_Configuration;
 
+/* Pin id to (configuration index + 1) table, PORT_PIN_NOT_CONFIGURED if the pin is not configured */
+extern const uint8 Port_PinIndex[PORT_PIN_ID_COUNT];
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -224,7 +299,8 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction);
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Refreshes port direction.
+* Description: Refreshes port direction. Does nothing while Port_ApplyProfile holds
+*              the SLEEP or SAFE profile.
 ************************************************************************************/
 void Port_RefreshPortDirection(void);
 
@@ -254,4 +330,31 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
 ************************************************************************************/
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
 
+/************************************************************************************
+* Service Name: Port_Verify
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Repair - TRUE to rewrite the registers that do not match the configuration
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Port_PinMaskType - PORT_PIN_MASK(pin id) set for every corrupted pin
+* Description: Reads back the direction, mode and pull registers of every port and compares
+*              them with the configuration, the pins changeable at run time are not checked.
+************************************************************************************/
+Port_PinMaskType Port_Verify(boolean Repair);
+
+/************************************************************************************
+* Service Name: Port_ApplyProfile
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Profile - PORT_PROFILE_RUN, PORT_PROFILE_SLEEP or PORT_PROFILE_SAFE
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Switches all pins to a pin profile with one write per register.
+************************************************************************************/
+void Port_ApplyProfile(Port_ProfileType Profile);
+
 #endif /* _PORT_H */
@@ -1,15 +1,24 @@
 /******************************************************************
  * File: port_PBCfg.c
  * @brief: This file contains the post-build configuration structure for the Port module.
- * 
+ *
+ *         GENERATED FILE, do not edit: change the pin description tables in tools/
+ *         and run python3 tools/port_cfg_gen.py
+ *
  * Author: Farah Ahmed
  * Date: April 5, 2024
- * 
+ *
  * AUTOSAR Version: 3.2.0
- * Target MCU: TIVAC123GH6PM
+ * Target MCU: TIVAC123GH6PM / STM32F103
  ********************************************************************/
 
 #include "port.h"
+#include "port_regs.h"
+#include "port_private.h"
+#if (PORT_BACKEND == PORT_BACKEND_STM32F103)
+/* Pins of the peripheral drivers claiming pins of the table */
+#include "Uart_Cfg.h"
+#endif
 
 /* Module version 1.0.0, initial release */
 #define PORT_PBCFG_SW_MAJOR_VERSION      (1)
@@ -37,57 +46,787 @@
 
 /*-------------------------------------------------------------------------------------*/
 
+#ifdef PORT_HOST_SIMULATION
+/* Register file standing for the GPIO ports in a host build */
+volatile uint32 Port_SimulatedPorts[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+/* Stores counted by PORT_REG_WRITE */
+uint32 Port_SimulatedStores[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+#endif
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+
+/* Generated from tools/port_pins_tm4c.txt */
+
+/* The configuration below is only valid with the pin ids, modes and register layout it was generated for */
+PORT_STATIC_ASSERT(PORT_CONFIGURED_PINS == 39, configured_pins);
+PORT_STATIC_ASSERT(PORT_PIN_ID_COUNT == 43U, pin_id_count);
+PORT_STATIC_ASSERT(PORT_NUMBER_OF_PORTS == 6, number_of_ports);
+PORT_STATIC_ASSERT(PORT_IMAGE_REGISTERS == 8, image_registers);
+PORT_STATIC_ASSERT(PORT_IMAGE_DATA == 0, image_data);
+PORT_STATIC_ASSERT(PORT_IMAGE_DIR == 1, image_dir);
+PORT_STATIC_ASSERT(PORT_IMAGE_PCTL == 2, image_pctl);
+PORT_STATIC_ASSERT(PORT_IMAGE_AFSEL == 3, image_afsel);
+PORT_STATIC_ASSERT(PORT_IMAGE_PUR == 4, image_pur);
+PORT_STATIC_ASSERT(PORT_IMAGE_PDR == 5, image_pdr);
+PORT_STATIC_ASSERT(PORT_IMAGE_DEN == 6, image_den);
+PORT_STATIC_ASSERT(PORT_IMAGE_AMSEL == 7, image_amsel);
+PORT_STATIC_ASSERT(PA0 == 0, pin_PA0);
+PORT_STATIC_ASSERT(PA1 == 1, pin_PA1);
+PORT_STATIC_ASSERT(PA2 == 2, pin_PA2);
+PORT_STATIC_ASSERT(PA3 == 3, pin_PA3);
+PORT_STATIC_ASSERT(PA4 == 4, pin_PA4);
+PORT_STATIC_ASSERT(PA5 == 5, pin_PA5);
+PORT_STATIC_ASSERT(PA6 == 6, pin_PA6);
+PORT_STATIC_ASSERT(PA7 == 7, pin_PA7);
+PORT_STATIC_ASSERT(PB0 == 8, pin_PB0);
+PORT_STATIC_ASSERT(PB1 == 9, pin_PB1);
+PORT_STATIC_ASSERT(PB2 == 10, pin_PB2);
+PORT_STATIC_ASSERT(PB3 == 11, pin_PB3);
+PORT_STATIC_ASSERT(PB4 == 12, pin_PB4);
+PORT_STATIC_ASSERT(PB5 == 13, pin_PB5);
+PORT_STATIC_ASSERT(PB6 == 14, pin_PB6);
+PORT_STATIC_ASSERT(PB7 == 15, pin_PB7);
+PORT_STATIC_ASSERT(PC4 == 20, pin_PC4);
+PORT_STATIC_ASSERT(PC5 == 21, pin_PC5);
+PORT_STATIC_ASSERT(PC6 == 22, pin_PC6);
+PORT_STATIC_ASSERT(PC7 == 23, pin_PC7);
+PORT_STATIC_ASSERT(PD0 == 24, pin_PD0);
+PORT_STATIC_ASSERT(PD1 == 25, pin_PD1);
+PORT_STATIC_ASSERT(PD2 == 26, pin_PD2);
+PORT_STATIC_ASSERT(PD3 == 27, pin_PD3);
+PORT_STATIC_ASSERT(PD4 == 28, pin_PD4);
+PORT_STATIC_ASSERT(PD5 == 29, pin_PD5);
+PORT_STATIC_ASSERT(PD6 == 30, pin_PD6);
+PORT_STATIC_ASSERT(PD7 == 31, pin_PD7);
+PORT_STATIC_ASSERT(PE0 == 32, pin_PE0);
+PORT_STATIC_ASSERT(PE1 == 33, pin_PE1);
+PORT_STATIC_ASSERT(PE2 == 34, pin_PE2);
+PORT_STATIC_ASSERT(PE3 == 35, pin_PE3);
+PORT_STATIC_ASSERT(PE4 == 36, pin_PE4);
+PORT_STATIC_ASSERT(PE5 == 37, pin_PE5);
+PORT_STATIC_ASSERT(PF0 == 38, pin_PF0);
+PORT_STATIC_ASSERT(PF1 == 39, pin_PF1);
+PORT_STATIC_ASSERT(PF2 == 40, pin_PF2);
+PORT_STATIC_ASSERT(PF3 == 41, pin_PF3);
+PORT_STATIC_ASSERT(PF4 == 42, pin_PF4);
+PORT_STATIC_ASSERT(PORT_NUMBER_OF_PROFILES == 3U, number_of_profiles);
+PORT_STATIC_ASSERT(PORT_PROFILE_RUN == 0U, profile_run);
+PORT_STATIC_ASSERT(PORT_PROFILE_SLEEP == 1U, profile_sleep);
+PORT_STATIC_ASSERT(PORT_PROFILE_SAFE == 2U, profile_safe);
+PORT_STATIC_ASSERT(ADC_Mode == 10, ADC_Mode);
+PORT_STATIC_ASSERT(Gpio_Mode == 0, Gpio_Mode);
+PORT_STATIC_ASSERT(PORT_PIN_IN == 0, PORT_PIN_IN);
+PORT_STATIC_ASSERT(PORT_PIN_OUT == 1, PORT_PIN_OUT);
+
+/* Register images of Port_Configuration, written as they are by Port_Init */
+STATIC const Port_PortImageType Port_ConfigurationImages[PORT_NUMBER_OF_PORTS] =
+{
+    /* PORTA */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x000000FFUL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x00000000UL }, /* PDR */
+            { 0x00000000UL , 0x00000000UL }, /* DEN */
+            { 0x00000000UL , 0x00000000UL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTB */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x000000FFUL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x00000000UL }, /* PDR */
+            { 0x00000000UL , 0x00000000UL }, /* DEN */
+            { 0x00000000UL , 0x00000000UL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTC */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000F0UL }, /* DIR */
+            { 0x00000000UL , 0xFFFF0000UL }, /* PCTL */
+            { 0x00000000UL , 0x000000F0UL }, /* AFSEL */
+            { 0x000000F0UL , 0x000000F0UL }, /* PUR */
+            { 0x00000000UL , 0x00000000UL }, /* PDR */
+            { 0x00000000UL , 0x00000000UL }, /* DEN */
+            { 0x00000000UL , 0x00000000UL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTD */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x000000FFUL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x00000000UL }, /* PDR */
+            { 0x00000000UL , 0x00000000UL }, /* DEN */
+            { 0x00000000UL , 0x00000000UL }  /* AMSEL */
+        },
+        0x00000080UL /* commit */
+    },
+    /* PORTE */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x0000003FUL }, /* DIR */
+            { 0x00000000UL , 0x00FFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x0000003FUL }, /* AFSEL */
+            { 0x0000003FUL , 0x0000003FUL }, /* PUR */
+            { 0x00000000UL , 0x00000000UL }, /* PDR */
+            { 0x00000000UL , 0x00000000UL }, /* DEN */
+            { 0x00000000UL , 0x00000000UL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTF */
+    {
+        {
+            { 0x00000000UL , 0x00000002UL }, /* DATA */
+            { 0x00000002UL , 0x0000001FUL }, /* DIR */
+            { 0x00000000UL , 0x000FFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x0000001FUL }, /* AFSEL */
+            { 0x0000001DUL , 0x0000001DUL }, /* PUR */
+            { 0x00000000UL , 0x00000000UL }, /* PDR */
+            { 0x00000012UL , 0x00000012UL }, /* DEN */
+            { 0x00000000UL , 0x00000012UL }  /* AMSEL */
+        },
+        0x00000001UL /* commit */
+    }
+};
+
+/* PB structure used with Port_Init API */
+const Port_ConfigType Port_Configuration =
+{
+    {
+        /* PORTA */
+        { PA0  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA1  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA2  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA3  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA4  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA5  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA6  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA7  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+
+        /* PORTB */
+        { PB0  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB1  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB2  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB3  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB4  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB5  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB6  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB7  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+
+        /* PORTC */
+        { PC4  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PC5  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PC6  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PC7  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+
+        /* PORTD */
+        { PD0  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PD1  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PD2  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PD3  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PD4  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PD5  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PD6  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PD7  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+
+        /* PORTE */
+        { PE0  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PE1  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PE2  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PE3  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PE4  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PE5  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+
+        /* PORTF */
+        { PF0  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PF1  , Gpio_Mode               , PORT_PIN_OUT              , NONE     , INITIAL_LOW , STD_OFF, STD_OFF, Enable  }, /* LED1 */
+        { PF2  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PF3  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PF4  , Gpio_Mode               , PORT_PIN_IN               , PULL_UP  , INITIAL_HIGH, STD_OFF, STD_OFF, Enable  } /* SW1 */
+    },
+    Port_ConfigurationImages
+};
+
+/* Pin id to configuration index table used by Port_SetPinDirection and Port_SetPinMode,
+ * each entry holds the index of the pin in Port_Configuration plus one so that pins without
+ * an entry stay PORT_PIN_NOT_CONFIGURED */
+const uint8 Port_PinIndex[PORT_PIN_ID_COUNT] =
+{
+ [PA0]   = 1,
+ [PA1]   = 2,
+ [PA2]   = 3,
+ [PA3]   = 4,
+ [PA4]   = 5,
+ [PA5]   = 6,
+ [PA6]   = 7,
+ [PA7]   = 8,
+ [PB0]   = 9,
+ [PB1]   = 10,
+ [PB2]   = 11,
+ [PB3]   = 12,
+ [PB4]   = 13,
+ [PB5]   = 14,
+ [PB6]   = 15,
+ [PB7]   = 16,
+ [PC4]   = 17,
+ [PC5]   = 18,
+ [PC6]   = 19,
+ [PC7]   = 20,
+ [PD0]   = 21,
+ [PD1]   = 22,
+ [PD2]   = 23,
+ [PD3]   = 24,
+ [PD4]   = 25,
+ [PD5]   = 26,
+ [PD6]   = 27,
+ [PD7]   = 28,
+ [PE0]   = 29,
+ [PE1]   = 30,
+ [PE2]   = 31,
+ [PE3]   = 32,
+ [PE4]   = 33,
+ [PE5]   = 34,
+ [PF0]   = 35,
+ [PF1]   = 36,
+ [PF2]   = 37,
+ [PF3]   = 38,
+ [PF4]   = 39
+};
+
+/* Register images of the RUN profile, every pin of the backend is set */
+STATIC const Port_PortImageType Port_RunProfileImages[PORT_NUMBER_OF_PORTS] =
+{
+    /* PORTA */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x000000FFUL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x000000FFUL }, /* PDR */
+            { 0x00000000UL , 0x000000FFUL }, /* DEN */
+            { 0x00000000UL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTB */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x000000FFUL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x000000FFUL }, /* PDR */
+            { 0x00000000UL , 0x000000FFUL }, /* DEN */
+            { 0x00000000UL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTC */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000F0UL }, /* DIR */
+            { 0x00000000UL , 0xFFFF0000UL }, /* PCTL */
+            { 0x00000000UL , 0x000000F0UL }, /* AFSEL */
+            { 0x000000F0UL , 0x000000F0UL }, /* PUR */
+            { 0x00000000UL , 0x000000F0UL }, /* PDR */
+            { 0x00000000UL , 0x000000F0UL }, /* DEN */
+            { 0x00000000UL , 0x000000F0UL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTD */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x000000FFUL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x000000FFUL }, /* PDR */
+            { 0x00000000UL , 0x000000FFUL }, /* DEN */
+            { 0x00000000UL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000080UL /* commit */
+    },
+    /* PORTE */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x0000003FUL }, /* DIR */
+            { 0x00000000UL , 0x00FFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x0000003FUL }, /* AFSEL */
+            { 0x0000003FUL , 0x0000003FUL }, /* PUR */
+            { 0x00000000UL , 0x0000003FUL }, /* PDR */
+            { 0x00000000UL , 0x0000003FUL }, /* DEN */
+            { 0x00000000UL , 0x0000003FUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTF */
+    {
+        {
+            { 0x00000000UL , 0x00000002UL }, /* DATA */
+            { 0x00000002UL , 0x0000001FUL }, /* DIR */
+            { 0x00000000UL , 0x000FFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x0000001FUL }, /* AFSEL */
+            { 0x0000001DUL , 0x0000001FUL }, /* PUR */
+            { 0x00000000UL , 0x0000001FUL }, /* PDR */
+            { 0x00000012UL , 0x0000001FUL }, /* DEN */
+            { 0x00000000UL , 0x0000001FUL }  /* AMSEL */
+        },
+        0x00000001UL /* commit */
+    }
+};
+
+/* Register images of the SLEEP profile, every pin of the backend is set */
+STATIC const Port_PortImageType Port_SleepProfileImages[PORT_NUMBER_OF_PORTS] =
+{
+    /* PORTA */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x000000FFUL , 0x000000FFUL }, /* AFSEL */
+            { 0x00000000UL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x000000FFUL }, /* PDR */
+            { 0x00000000UL , 0x000000FFUL }, /* DEN */
+            { 0x000000FFUL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTB */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x000000FFUL , 0x000000FFUL }, /* AFSEL */
+            { 0x00000000UL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x000000FFUL }, /* PDR */
+            { 0x00000000UL , 0x000000FFUL }, /* DEN */
+            { 0x000000FFUL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTC */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000F0UL }, /* DIR */
+            { 0x00000000UL , 0xFFFF0000UL }, /* PCTL */
+            { 0x000000F0UL , 0x000000F0UL }, /* AFSEL */
+            { 0x00000000UL , 0x000000F0UL }, /* PUR */
+            { 0x00000000UL , 0x000000F0UL }, /* PDR */
+            { 0x00000000UL , 0x000000F0UL }, /* DEN */
+            { 0x000000F0UL , 0x000000F0UL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTD */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x000000FFUL , 0x000000FFUL }, /* AFSEL */
+            { 0x00000000UL , 0x000000FFUL }, /* PUR */
+            { 0x00000000UL , 0x000000FFUL }, /* PDR */
+            { 0x00000000UL , 0x000000FFUL }, /* DEN */
+            { 0x000000FFUL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000080UL /* commit */
+    },
+    /* PORTE */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x0000003FUL }, /* DIR */
+            { 0x00000000UL , 0x00FFFFFFUL }, /* PCTL */
+            { 0x0000003FUL , 0x0000003FUL }, /* AFSEL */
+            { 0x00000000UL , 0x0000003FUL }, /* PUR */
+            { 0x00000000UL , 0x0000003FUL }, /* PDR */
+            { 0x00000000UL , 0x0000003FUL }, /* DEN */
+            { 0x0000003FUL , 0x0000003FUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTF */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x0000001FUL }, /* DIR */
+            { 0x00000000UL , 0x000FFFFFUL }, /* PCTL */
+            { 0x0000000FUL , 0x0000001FUL }, /* AFSEL */
+            { 0x00000010UL , 0x0000001FUL }, /* PUR */
+            { 0x00000000UL , 0x0000001FUL }, /* PDR */
+            { 0x00000010UL , 0x0000001FUL }, /* DEN */
+            { 0x0000000FUL , 0x0000001FUL }  /* AMSEL */
+        },
+        0x00000001UL /* commit */
+    }
+};
+
+/* Register images of the SAFE profile, every pin of the backend is set */
+STATIC const Port_PortImageType Port_SafeProfileImages[PORT_NUMBER_OF_PORTS] =
+{
+    /* PORTA */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x00000000UL , 0x000000FFUL }, /* PUR */
+            { 0x000000FFUL , 0x000000FFUL }, /* PDR */
+            { 0x000000FFUL , 0x000000FFUL }, /* DEN */
+            { 0x00000000UL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTB */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x00000000UL , 0x000000FFUL }, /* PUR */
+            { 0x000000FFUL , 0x000000FFUL }, /* PDR */
+            { 0x000000FFUL , 0x000000FFUL }, /* DEN */
+            { 0x00000000UL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTC */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000F0UL }, /* DIR */
+            { 0x00000000UL , 0xFFFF0000UL }, /* PCTL */
+            { 0x00000000UL , 0x000000F0UL }, /* AFSEL */
+            { 0x00000000UL , 0x000000F0UL }, /* PUR */
+            { 0x000000F0UL , 0x000000F0UL }, /* PDR */
+            { 0x000000F0UL , 0x000000F0UL }, /* DEN */
+            { 0x00000000UL , 0x000000F0UL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTD */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x000000FFUL }, /* DIR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x000000FFUL }, /* AFSEL */
+            { 0x00000000UL , 0x000000FFUL }, /* PUR */
+            { 0x000000FFUL , 0x000000FFUL }, /* PDR */
+            { 0x000000FFUL , 0x000000FFUL }, /* DEN */
+            { 0x00000000UL , 0x000000FFUL }  /* AMSEL */
+        },
+        0x00000080UL /* commit */
+    },
+    /* PORTE */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* DATA */
+            { 0x00000000UL , 0x0000003FUL }, /* DIR */
+            { 0x00000000UL , 0x00FFFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x0000003FUL }, /* AFSEL */
+            { 0x00000000UL , 0x0000003FUL }, /* PUR */
+            { 0x0000003FUL , 0x0000003FUL }, /* PDR */
+            { 0x0000003FUL , 0x0000003FUL }, /* DEN */
+            { 0x00000000UL , 0x0000003FUL }  /* AMSEL */
+        },
+        0x00000000UL /* commit */
+    },
+    /* PORTF */
+    {
+        {
+            { 0x00000000UL , 0x00000002UL }, /* DATA */
+            { 0x00000002UL , 0x0000001FUL }, /* DIR */
+            { 0x00000000UL , 0x000FFFFFUL }, /* PCTL */
+            { 0x00000000UL , 0x0000001FUL }, /* AFSEL */
+            { 0x00000000UL , 0x0000001FUL }, /* PUR */
+            { 0x0000001DUL , 0x0000001FUL }, /* PDR */
+            { 0x0000001FUL , 0x0000001FUL }, /* DEN */
+            { 0x00000000UL , 0x0000001FUL }  /* AMSEL */
+        },
+        0x00000001UL /* commit */
+    }
+};
+
+/* Register images of every profile, indexed by the PORT_PROFILE_<NAME> ids */
+const Port_PortImageType * const Port_ProfileImages[PORT_NUMBER_OF_PROFILES] =
+{
+    Port_RunProfileImages,
+    Port_SleepProfileImages,
+    Port_SafeProfileImages
+};
+
+#elif (PORT_BACKEND == PORT_BACKEND_STM32F103)
+
+/* Generated from tools/port_pins_stm32f103.txt */
+
+/* The configuration below is only valid with the pin ids, modes and register layout it was generated for */
+PORT_STATIC_ASSERT(PORT_CONFIGURED_PINS == 33, configured_pins);
+PORT_STATIC_ASSERT(PORT_PIN_ID_COUNT == 48U, pin_id_count);
+PORT_STATIC_ASSERT(PORT_NUMBER_OF_PORTS == 3, number_of_ports);
+PORT_STATIC_ASSERT(PORT_IMAGE_REGISTERS == 3, image_registers);
+PORT_STATIC_ASSERT(PORT_IMAGE_ODR == 0, image_odr);
+PORT_STATIC_ASSERT(PORT_IMAGE_CRL == 1, image_crl);
+PORT_STATIC_ASSERT(PORT_IMAGE_CRH == 2, image_crh);
+PORT_STATIC_ASSERT(PA0 == 0, pin_PA0);
+PORT_STATIC_ASSERT(PA1 == 1, pin_PA1);
+PORT_STATIC_ASSERT(PA2 == 2, pin_PA2);
+PORT_STATIC_ASSERT(PA3 == 3, pin_PA3);
+PORT_STATIC_ASSERT(PA4 == 4, pin_PA4);
+PORT_STATIC_ASSERT(PA5 == 5, pin_PA5);
+PORT_STATIC_ASSERT(PA6 == 6, pin_PA6);
+PORT_STATIC_ASSERT(PA7 == 7, pin_PA7);
+PORT_STATIC_ASSERT(PA8 == 8, pin_PA8);
+PORT_STATIC_ASSERT(PA9 == 9, pin_PA9);
+PORT_STATIC_ASSERT(PA10 == 10, pin_PA10);
+PORT_STATIC_ASSERT(PA11 == 11, pin_PA11);
+PORT_STATIC_ASSERT(PA12 == 12, pin_PA12);
+PORT_STATIC_ASSERT(PA15 == 15, pin_PA15);
+PORT_STATIC_ASSERT(PB0 == 16, pin_PB0);
+PORT_STATIC_ASSERT(PB1 == 17, pin_PB1);
+PORT_STATIC_ASSERT(PB2 == 18, pin_PB2);
+PORT_STATIC_ASSERT(PB3 == 19, pin_PB3);
+PORT_STATIC_ASSERT(PB4 == 20, pin_PB4);
+PORT_STATIC_ASSERT(PB5 == 21, pin_PB5);
+PORT_STATIC_ASSERT(PB6 == 22, pin_PB6);
+PORT_STATIC_ASSERT(PB7 == 23, pin_PB7);
+PORT_STATIC_ASSERT(PB8 == 24, pin_PB8);
+PORT_STATIC_ASSERT(PB9 == 25, pin_PB9);
+PORT_STATIC_ASSERT(PB10 == 26, pin_PB10);
+PORT_STATIC_ASSERT(PB11 == 27, pin_PB11);
+PORT_STATIC_ASSERT(PB12 == 28, pin_PB12);
+PORT_STATIC_ASSERT(PB13 == 29, pin_PB13);
+PORT_STATIC_ASSERT(PB14 == 30, pin_PB14);
+PORT_STATIC_ASSERT(PB15 == 31, pin_PB15);
+PORT_STATIC_ASSERT(PC13 == 45, pin_PC13);
+PORT_STATIC_ASSERT(PC14 == 46, pin_PC14);
+PORT_STATIC_ASSERT(PC15 == 47, pin_PC15);
+PORT_STATIC_ASSERT(PORT_NUMBER_OF_PROFILES == 3U, number_of_profiles);
+PORT_STATIC_ASSERT(PORT_PROFILE_RUN == 0U, profile_run);
+PORT_STATIC_ASSERT(PORT_PROFILE_SLEEP == 1U, profile_sleep);
+PORT_STATIC_ASSERT(PORT_PROFILE_SAFE == 2U, profile_safe);
+PORT_STATIC_ASSERT(AF_OPP == 2, AF_OPP);
+PORT_STATIC_ASSERT(ANALOG_INPUT == 0, ANALOG_INPUT);
+PORT_STATIC_ASSERT(FLOATING_INPUT == 1, FLOATING_INPUT);
+PORT_STATIC_ASSERT(GP_OPP == 0, GP_OPP);
+PORT_STATIC_ASSERT(PORT_PIN_IN == 0, PORT_PIN_IN);
+PORT_STATIC_ASSERT(PORT_PIN_OUT_2MHz == 2, PORT_PIN_OUT_2MHz);
+PORT_STATIC_ASSERT(PULL_INPUT == 2, PULL_INPUT);
+
+/* Pins claimed by peripherals: the row of the table is the pin, mode and direction
+ * the peripheral driver sets up */
+PORT_STATIC_ASSERT((UART1_TX_PIN == PA9) && (UART1_TX_MODE == AF_OPP) && (UART1_TX_DIRECTION == PORT_PIN_OUT_2MHz), UART1_TX_PA9);
+PORT_STATIC_ASSERT((UART1_RX_PIN == PA10) && (UART1_RX_MODE == FLOATING_INPUT) && (UART1_RX_DIRECTION == PORT_PIN_IN), UART1_RX_PA10);
+
+/* Register images of Port_Configuration, written as they are by Port_Init */
+STATIC const Port_PortImageType Port_ConfigurationImages[PORT_NUMBER_OF_PORTS] =
+{
+    /* PORTA */
+    {
+        {
+            { 0x000099FFUL , 0x000099FFUL }, /* ODR */
+            { 0x88888888UL , 0xFFFFFFFFUL }, /* CRL */
+            { 0x800884A8UL , 0xF00FFFFFUL }  /* CRH */
+        }
+    },
+    /* PORTB */
+    {
+        {
+            { 0x0000FFFFUL , 0x0000FFFFUL }, /* ODR */
+            { 0x88888888UL , 0xFFFFFFFFUL }, /* CRL */
+            { 0x88888888UL , 0xFFFFFFFFUL }  /* CRH */
+        }
+    },
+    /* PORTC */
+    {
+        {
+            { 0x0000E000UL , 0x0000E000UL }, /* ODR */
+            { 0x00000000UL , 0x00000000UL }, /* CRL */
+            { 0x88200000UL , 0xFFF00000UL }  /* CRH */
+        }
+    }
+};
+
 /* PB structure used with Port_Init API */
 const Port_ConfigType Port_Configuration =
 {
- /* PORTA */
- PortConf_PA0 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PA1 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PA2 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PA3 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PA4 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PA5 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PA6 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PA7 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
-
- /* PORTB */
- PortConf_PB0 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PB1 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PB2 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PB3 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PB4 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PB5 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PB6 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PB7 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
-
- /* PORTC */
- PortConf_PC4 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PC5 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PC6 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PC7 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
-
- /* PORTD */
- PortConf_PD0 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PD1 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PD2 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PD3 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PD4 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PD5 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PD6 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PD7 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
-
- /* PORTE */
- PortConf_PE0 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PE1 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PE2 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PE3 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PE4 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
- PortConf_PE5 ,PortConf_DEFAULT_MODE , PortConf_DEFAULT_DIRECTION ,PortConf_DEFAULT_RESISTOR ,PortConf_DEFAULT_INITIAL_VALUE,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH,PortConf_DEFAULT_ENABLE ,
-
- /* PORTF */
- PortConf_PF0          , PortConf_DEFAULT_MODE   , PortConf_DEFAULT_DIRECTION   ,PortConf_DEFAULT_RESISTOR   ,PortConf_DEFAULT_INITIAL_VALUE ,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH ,PortConf_DEFAULT_ENABLE ,
- PortConf_LED1_PIN_TYPE, PortConf_LED1_MODE_TYPE , PortConf_LED1_DIRECTION_TYPE ,PortConf_LED1_RESISTOR_TYPE ,PortConf_LED1_INITIAL_VALUE    ,PortConf_LED1_DIR_CH    ,PortConf_LED1_MODE_CH    ,PortConf_LED1_ENABLE ,
- PortConf_PF2          , PortConf_DEFAULT_MODE   , PortConf_DEFAULT_DIRECTION   ,PortConf_DEFAULT_RESISTOR   ,PortConf_DEFAULT_INITIAL_VALUE ,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH ,PortConf_DEFAULT_ENABLE ,
- PortConf_PF3          , PortConf_DEFAULT_MODE   , PortConf_DEFAULT_DIRECTION   ,PortConf_DEFAULT_RESISTOR   ,PortConf_DEFAULT_INITIAL_VALUE ,PortConf_DEFAULT_DIR_CH ,PortConf_DEFAULT_MODE_CH ,PortConf_DEFAULT_ENABLE ,
- PortConf_SW1_PIN_TYPE , PortConf_SW1_MODE_TYPE  , PortConf_SW1_DIRECTION_TYPE  ,PortConf_SW1_RESISTOR_TYPE  ,PortConf_SW1_INITIAL_VALUE     ,PortConf_SW1_DIR_CH     ,PortConf_SW1_MODE_CH     ,PortConf_SW1_ENABLE
+    {
+        /* PORTA */
+        { PA0  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Enable  }, /* SW1 */
+        { PA1  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA2  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA3  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA4  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA5  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA6  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA7  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA8  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA9  , AF_OPP                  , PORT_PIN_OUT_2MHz         , NONE     , NO_INITIAL  , STD_ON , STD_ON , Enable  }, /* UART1 TX, set again by the uart driver */
+        { PA10 , FLOATING_INPUT          , PORT_PIN_IN               , NONE     , NO_INITIAL  , STD_ON , STD_ON , Enable  }, /* UART1 RX, set again by the uart driver */
+        { PA11 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA12 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PA15 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+
+        /* PORTB */
+        { PB0  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB1  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB2  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB3  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB4  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB5  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB6  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB7  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB8  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB9  , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB10 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB11 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB12 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB13 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB14 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PB15 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+
+        /* PORTC */
+        { PC13 , GP_OPP                  , PORT_PIN_OUT_2MHz         , NONE     , INITIAL_HIGH, STD_OFF, STD_OFF, Enable  }, /* LED1, active low */
+        { PC14 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable },
+        { PC15 , PULL_INPUT              , PORT_PIN_IN               , PULL_UP  , NO_INITIAL  , STD_OFF, STD_OFF, Disable }
+    },
+    Port_ConfigurationImages
+};
+
+/* Pin id to configuration index table used by Port_SetPinDirection and Port_SetPinMode,
+ * each entry holds the index of the pin in Port_Configuration plus one so that pins without
+ * an entry stay PORT_PIN_NOT_CONFIGURED */
+const uint8 Port_PinIndex[PORT_PIN_ID_COUNT] =
+{
+ [PA0]   = 1,
+ [PA1]   = 2,
+ [PA2]   = 3,
+ [PA3]   = 4,
+ [PA4]   = 5,
+ [PA5]   = 6,
+ [PA6]   = 7,
+ [PA7]   = 8,
+ [PA8]   = 9,
+ [PA9]   = 10,
+ [PA10]  = 11,
+ [PA11]  = 12,
+ [PA12]  = 13,
+ [PA15]  = 14,
+ [PB0]   = 15,
+ [PB1]   = 16,
+ [PB2]   = 17,
+ [PB3]   = 18,
+ [PB4]   = 19,
+ [PB5]   = 20,
+ [PB6]   = 21,
+ [PB7]   = 22,
+ [PB8]   = 23,
+ [PB9]   = 24,
+ [PB10]  = 25,
+ [PB11]  = 26,
+ [PB12]  = 27,
+ [PB13]  = 28,
+ [PB14]  = 29,
+ [PB15]  = 30,
+ [PC13]  = 31,
+ [PC14]  = 32,
+ [PC15]  = 33
+};
+
+/* Register images of the SLEEP profile, every pin of the backend is set */
+STATIC const Port_PortImageType Port_SleepProfileImages[PORT_NUMBER_OF_PORTS] =
+{
+    /* PORTA */
+    {
+        {
+            { 0x00000001UL , 0x00000001UL }, /* ODR */
+            { 0x00000008UL , 0xFFFFFFFFUL }, /* CRL */
+            { 0x00000000UL , 0xF00FFFFFUL }  /* CRH */
+        }
+    },
+    /* PORTB */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* ODR */
+            { 0x00000000UL , 0xFFFFFFFFUL }, /* CRL */
+            { 0x00000000UL , 0xFFFFFFFFUL }  /* CRH */
+        }
+    },
+    /* PORTC */
+    {
+        {
+            { 0x00000000UL , 0x00000000UL }, /* ODR */
+            { 0x00000000UL , 0x00000000UL }, /* CRL */
+            { 0x00000000UL , 0xFFF00000UL }  /* CRH */
+        }
+    }
 };
+
+/* Register images of the SAFE profile, every pin of the backend is set */
+STATIC const Port_PortImageType Port_SafeProfileImages[PORT_NUMBER_OF_PORTS] =
+{
+    /* PORTA */
+    {
+        {
+            { 0x00000000UL , 0x00009FFFUL }, /* ODR */
+            { 0x88888888UL , 0xFFFFFFFFUL }, /* CRL */
+            { 0x80088888UL , 0xF00FFFFFUL }  /* CRH */
+        }
+    },
+    /* PORTB */
+    {
+        {
+            { 0x00000000UL , 0x0000FFFFUL }, /* ODR */
+            { 0x88888888UL , 0xFFFFFFFFUL }, /* CRL */
+            { 0x88888888UL , 0xFFFFFFFFUL }  /* CRH */
+        }
+    },
+    /* PORTC */
+    {
+        {
+            { 0x00002000UL , 0x0000E000UL }, /* ODR */
+            { 0x00000000UL , 0x00000000UL }, /* CRL */
+            { 0x88200000UL , 0xFFF00000UL }  /* CRH */
+        }
+    }
+};
+
+/* Register images of every profile, indexed by the PORT_PROFILE_<NAME> ids */
+const Port_PortImageType * const Port_ProfileImages[PORT_NUMBER_OF_PROFILES] =
+{
+    Port_ConfigurationImages,
+    Port_SleepProfileImages,
+    Port_SafeProfileImages
+};
+
+#endif /* PORT_BACKEND */
@@ -1,93 +1,32 @@
 /*********************************************************************************
  * File: port_private.c
- * @brief: This file contains the private functions definition for the Port module.
+ * @brief: This file contains the private functions definition for the Port module
+ *         shared by all the Port backends.
  * 
  * Author: Farah Ahmed
  * Date: April 5, 2024
  * 
  * AUTOSAR Version: 3.2.0
- * Target MCU: TIVAC123GH6PM
+ * Target MCU: TIVAC123GH6PM / STM32F103
  ********************************************************************************/
 #include "port_private.h"
-#include "common_macros.h"
-#include "port_regs.h"
 #include "port.h"
 
 /**
- * @brief: Retrieves the port number of a given pin ID.
+ * @brief: Retrieves the index of a given pin ID in the configuration array.
+ *         The lookup is a single load from Port_PinIndex instead of a search over the configured pins.
  * 
  * @param copy_pinId: The ID of the pin.
- * @return: The port number of the specified pin.
+ * @return: The configuration index of the pin, PORT_INVALID_CONFIG_INDEX if it is not configured.
  */
-
-
-uint8 Port_GetNumber(uint8 copy_pinId)
+uint8 Port_GetConfigIndex(uint8 copy_pinId)
 {
-    if (copy_pinId <= 7)
-    {
-        return PORTA;
-    }
-
-    if (copy_pinId >= 8 && copy_pinId <= 15)
-    {
-        return PORTB;
-    }
+    uint8 index = PORT_INVALID_CONFIG_INDEX;
 
-    if (copy_pinId >= 20 && copy_pinId <= 23)
+    if ((copy_pinId < PORT_PIN_ID_COUNT) && (Port_PinIndex[copy_pinId] != PORT_PIN_NOT_CONFIGURED))
     {
-        return PORTC;
+        index = Port_PinIndex[copy_pinId] - 1;
     }
 
-    if (copy_pinId >= 24 && copy_pinId <= 31)
-    {
-        return PORTD;
-    }
-
-    if (copy_pinId >= 32 && copy_pinId <= 37)
-    {
-        return PORTE;
-    }
-
-    if (copy_pinId >= 38 && copy_pinId <= 42)
-    {
-        return PORTF;
-    }
-
-    return 0 ;
+    return index;
 }
-
-/**
- * @brief: Retrieves the pin number of a given port number and pin ID.
- * 
- * @param copy_portNum: The port number.
- * @param copy_pinId: The ID of the pin.
- * @return: The pin number of the specified port and pin ID.
- */
-uint8 Pin_GetNumber(uint8 copy_portNum, uint8 copy_pinId)
-{
-    uint8 number = 0;
-    switch (copy_portNum)
-    {
-    case PORTA:
-        number = copy_pinId;
-        break;
-    case PORTB:
-        number = copy_pinId - 8;
-        break;
-    case PORTC:
-        number = copy_pinId - 16;
-        break;
-    case PORTD:
-        number = copy_pinId - 24;
-        break;
-    case PORTE:
-        number = copy_pinId - 32;
-        break;
-    case PORTF:
-        number = copy_pinId - 38;
-        break;
-    }
-    return number;
-}
-
-
@@ -6,12 +6,13 @@
  * Date: April 5, 2024
  * 
  * AUTOSAR Version: 3.2.0
- * Target MCU: TIVAC123GH6PM
+ * Target MCU: TIVAC123GH6PM / STM32F103
  ********************************************************************/
 #ifndef _PORT_PRIVATE_H
 #define _PORT_PRIVATE_H
 
 #include "port.h"
+#include "port_regs.h"
 #include "std_types.h"
 
 
@@ -19,9 +20,76 @@
 #define PORTA       (0) /* Port A */
 #define PORTB       (1) /* Port B */
 #define PORTC       (2) /* Port C */
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
 #define PORTD       (3) /* Port D */
 #define PORTE       (4) /* Port E */
 #define PORTF       (5) /* Port F */
+#endif
+
+/* Configuration index returned for a pin id that is not configured */
+#define PORT_INVALID_CONFIG_INDEX   (0xFF)
+
+/* Compile time check used by the generated configuration, the build fails if COND is false */
+#define PORT_STATIC_ASSERT(COND, NAME)  typedef char Port_StaticCheck_##NAME[(COND) ? 1 : -1]
+
+/*******************************************************************************
+ *                              Private Data Types                             *
+ *******************************************************************************/
+
+/* Registers of a port that are programmed from a register image */
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+typedef enum
+{
+    PORT_IMAGE_DATA,
+    PORT_IMAGE_DIR,
+    PORT_IMAGE_PCTL,    /* written before GPIOAFSEL so that the function is selected before it is enabled */
+    PORT_IMAGE_AFSEL,
+    PORT_IMAGE_PUR,
+    PORT_IMAGE_PDR,
+    PORT_IMAGE_DEN,
+    PORT_IMAGE_AMSEL,
+    PORT_IMAGE_REGISTERS
+}Port_ImageRegister;
+#elif (PORT_BACKEND == PORT_BACKEND_STM32F103)
+typedef enum
+{
+    PORT_IMAGE_ODR,     /* written first: initial levels and pull-up / pull-down selection */
+    PORT_IMAGE_CRL,
+    PORT_IMAGE_CRH,
+    PORT_IMAGE_REGISTERS
+}Port_ImageRegister;
+#endif
+
+/* Final content of one register: bits of mask are replaced by the bits of value */
+typedef struct
+{
+    uint32 value;
+    uint32 mask;
+}Port_RegImageType;
+
+/* Register images of one port, commit holds the GPIOCR bits of the locked pins to be changed (TM4C) */
+typedef struct Port_PortImage
+{
+    Port_RegImageType reg[PORT_IMAGE_REGISTERS];
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+    uint32 commit;
+#endif
+}Port_PortImageType;
+
+/* Bits of each register of one port checked by Port_Verify */
+typedef struct
+{
+    uint32 check[PORT_IMAGE_REGISTERS];
+}Port_VerifyMaskType;
+
+/* Base address of each port */
+extern volatile uint32 * const Port_BaseAddress[PORT_NUMBER_OF_PORTS];
+
+/* Offset of each register of Port_ImageRegister */
+extern const uint16 Port_ImageRegOffset[PORT_IMAGE_REGISTERS];
+
+/* Register images of every pin profile, indexed by the PORT_PROFILE_<NAME> ids (port_PBCfg.c) */
+extern const Port_PortImageType * const Port_ProfileImages[PORT_NUMBER_OF_PROFILES];
 
 /*******************************************************************************
  *                              FUNCTION PROTOTYPES                            *
@@ -44,5 +112,77 @@ uint8 Port_GetNumber(uint8 copy_pinId);
  */
 uint8 Pin_GetNumber(uint8 copy_portNum, uint8 copy_pinId);
 
+/**
+ * @brief: Retrieves the index of a given pin ID in the configuration array.
+ * 
+ * @param copy_pinId: The ID of the pin.
+ * @return: The configuration index of the pin, PORT_INVALID_CONFIG_INDEX if it is not configured.
+ */
+uint8 Port_GetConfigIndex(uint8 copy_pinId);
+
+/**
+ * @brief: Computes the register images of all ports from the configuration array.
+ * 
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images to be filled.
+ */
+void Port_BuildImages(const Port_ChannelConfig *copy_config, Port_PortImageType *copy_images);
+
+/**
+ * @brief: Extends the images of a configuration so that every configured pin is set whole, the
+ *         bits its images do not write take their reset value. Used to return to the
+ *         configuration of Port_Init from another pin profile.
+ * 
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images of copy_config to be completed.
+ */
+void Port_CompleteImages(const Port_ChannelConfig *copy_config, Port_PortImageType *copy_images);
+
+/**
+ * @brief: Writes the register images of all ports, each register of a port is written once.
+ * 
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images.
+ */
+void Port_WriteImages(const Port_PortImageType *copy_images);
+
+/**
+ * @brief: Changes the direction of one pin, the other pins of the port are kept.
+ * 
+ * @param copy_pinId: The ID of the pin.
+ * @param copy_direction: The new direction of the pin.
+ */
+void Port_WritePinDirection(uint8 copy_pinId, Port_PinDirectionType copy_direction);
+
+/**
+ * @brief: Changes the mode of one pin, the other pins of the port are kept.
+ * 
+ * @param copy_pinId: The ID of the pin.
+ * @param copy_mode: The new mode of the pin.
+ */
+void Port_WritePinMode(uint8 copy_pinId, Port_PinModeType copy_mode);
+
+/**
+ * @brief: Computes the bits of every register that Port_VerifyImages may check among the
+ *         bits written by the images: all but the output levels and the fields of the pins
+ *         whose direction or mode is changeable at run time.
+ *
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_masks: The PORT_NUMBER_OF_PORTS verify masks to be filled.
+ */
+void Port_BuildVerifyMasks(const Port_ChannelConfig *copy_config, Port_VerifyMaskType *copy_masks);
+
+/**
+ * @brief: Reads every checked register once and compares it with its image, a register
+ *         that does not match can be repaired with a single write.
+ *
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images expected in the registers (configuration
+ *                     or profile), only the bits they write are checked.
+ * @param copy_masks: The PORT_NUMBER_OF_PORTS verify masks.
+ * @param copy_repair: TRUE to rewrite the checked bits of the registers that do not match.
+ * @return: PORT_PIN_MASK(pin id) set for every pin with at least one wrong checked bit.
+ */
+Port_PinMaskType Port_VerifyImages(const Port_PortImageType *copy_images, const Port_VerifyMaskType *copy_masks,
+                                   boolean copy_repair);
+
 
 #endif /* _PORT_PRIVATE_H */
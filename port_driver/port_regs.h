@@ -1,12 +1,12 @@
 /******************************************************************
  * File: port_regs.h
  * @brief: This file contains the registers definition for the Port module.
- * 
+ *
  * Author: Farah Ahmed
  * Date: April 5, 2024
- * 
+ *
  * AUTOSAR Version: 3.2.0
- * Target MCU: TIVAC123GH6PM
+ * Target MCU: TIVAC123GH6PM / STM32F103
  ********************************************************************/
 
 
@@ -15,6 +15,7 @@
 
 
 #include "std_types.h"
+#include "port_Cfg.h"
 
 
 
@@ -22,13 +23,22 @@
  *                              Module Definitions                             *
  *******************************************************************************/
 
-/* GPIO Registers base addresses */
-#define GPIO_PORTA_BASE_ADDRESS           0x40004000
-#define GPIO_PORTB_BASE_ADDRESS           0x40005000
-#define GPIO_PORTC_BASE_ADDRESS           0x40006000
-#define GPIO_PORTD_BASE_ADDRESS           0x40007000
-#define GPIO_PORTE_BASE_ADDRESS           0x40024000
-#define GPIO_PORTF_BASE_ADDRESS           0x40025000
+/*
+ * Register at byte offset OFFSET of the port whose base address is BASE (volatile uint32 *).
+ * The register is addressed in words so that the layout stays the same in a host build
+ * where uint32 is wider than 4 bytes.
+ */
+#define PORT_REG(BASE, OFFSET)            (*((BASE) + ((OFFSET) / 4)))
+
+#ifndef PORT_HOST_SIMULATION
+/* Single store of VALUE to a register, used by the writers of the register images */
+#define PORT_REG_WRITE(BASE, OFFSET, VALUE)   (PORT_REG(BASE, OFFSET) = (VALUE))
+#endif
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+
+/* Number of GPIO ports (A..F) */
+#define PORT_NUMBER_OF_PORTS              (6)
 
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
@@ -42,5 +52,99 @@
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
+/* Pins of a port, one GPIOPCTL field each */
+#define PORT_PINS_PER_PORT                (8)
+
+/* Width and mask of the PMC field of one pin in GPIOPCTL */
+#define PORT_PCTL_FIELD_WIDTH             (4)
+#define PORT_PCTL_FIELD_MASK              (0xFUL)
+
+/* Value written to GPIOLOCK to unlock the GPIOCR register */
+#define PORT_UNLOCK_VALUE                 0x4C4F434B
+
+/* Offset of the last register of a port */
+#define PORT_LAST_REG_OFFSET              PORT_CTL_REG_OFFSET
+
+#ifndef PORT_HOST_SIMULATION
+
+/* GPIO Registers base addresses */
+#define GPIO_PORTA_BASE_ADDRESS           0x40004000
+#define GPIO_PORTB_BASE_ADDRESS           0x40005000
+#define GPIO_PORTC_BASE_ADDRESS           0x40006000
+#define GPIO_PORTD_BASE_ADDRESS           0x40007000
+#define GPIO_PORTE_BASE_ADDRESS           0x40024000
+#define GPIO_PORTF_BASE_ADDRESS           0x40025000
+
+#endif /* PORT_HOST_SIMULATION */
+
+#elif (PORT_BACKEND == PORT_BACKEND_STM32F103)
+
+/* Number of GPIO ports (A..C) */
+#define PORT_NUMBER_OF_PORTS              (3)
+
+/* GPIO Registers offset addresses */
+#define PORT_CRL_REG_OFFSET               0x00
+#define PORT_CRH_REG_OFFSET               0x04
+#define PORT_IDR_REG_OFFSET               0x08
+#define PORT_ODR_REG_OFFSET               0x0C
+#define PORT_BSRR_REG_OFFSET              0x10
+#define PORT_BRR_REG_OFFSET               0x14
+#define PORT_LCKR_REG_OFFSET              0x18
+
+/* Offset of the last register of a port */
+#define PORT_LAST_REG_OFFSET              PORT_LCKR_REG_OFFSET
+
+/* Pins of a port covered by CRL, the remaining ones are in CRH */
+#define PORT_PINS_PER_CR_REG              (8)
+
+/* Width and mask of the MODE[1:0] / CNF[1:0] field of one pin in CRL / CRH */
+#define PORT_CR_FIELD_WIDTH               (4)
+#define PORT_CR_FIELD_MASK                (0xFUL)
+#define PORT_CR_MODE_MASK                 (0x3UL)
+#define PORT_CR_CNF_SHIFT                 (2)
+
+/* CRL / CRH field of one pin: CNF[1:0] in bits 3..2, MODE[1:0] in bits 1..0 */
+#define PORT_CR_FIELD(CNF, MODE)          ((((uint32)(CNF)) << PORT_CR_CNF_SHIFT) | ((uint32)(MODE)))
+
+#ifndef PORT_HOST_SIMULATION
+
+/* GPIO Registers base addresses */
+#define GPIO_PORTA_BASE_ADDRESS           0x40010800
+#define GPIO_PORTB_BASE_ADDRESS           0x40010C00
+#define GPIO_PORTC_BASE_ADDRESS           0x40011000
+
+#endif /* PORT_HOST_SIMULATION */
+
+#else
+  #error "PORT_BACKEND is not a supported Port backend"
+#endif /* PORT_BACKEND */
+
+#ifdef PORT_HOST_SIMULATION
+
+/*
+ * Host build: every port is a simulated register file (defined in port_PBCfg.c)
+ * large enough to hold all the registers of the port at their real offsets.
+ */
+#define PORT_SIMULATED_PORT_WORDS         ((PORT_LAST_REG_OFFSET / 4) + 1)
+
+extern volatile uint32 Port_SimulatedPorts[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+
+#define GPIO_PORTA_BASE_ADDRESS           (Port_SimulatedPorts[0])
+#define GPIO_PORTB_BASE_ADDRESS           (Port_SimulatedPorts[1])
+#define GPIO_PORTC_BASE_ADDRESS           (Port_SimulatedPorts[2])
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+#define GPIO_PORTD_BASE_ADDRESS           (Port_SimulatedPorts[3])
+#define GPIO_PORTE_BASE_ADDRESS           (Port_SimulatedPorts[4])
+#define GPIO_PORTF_BASE_ADDRESS           (Port_SimulatedPorts[5])
+#endif
+
+/* Stores of PORT_REG_WRITE to every register of Port_SimulatedPorts, cleared by the tests */
+extern uint32 Port_SimulatedStores[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+
+#define PORT_REG_WRITE(BASE, OFFSET, VALUE)   (PORT_REG(BASE, OFFSET) = (VALUE), \
+        Port_SimulatedStores[((BASE) - Port_SimulatedPorts[0]) / PORT_SIMULATED_PORT_WORDS][(OFFSET) / 4]++)
+
+#endif /* PORT_HOST_SIMULATION */
+
 
 #endif /* _PORT_REGS_H */
@@ -0,0 +1,405 @@
+/*********************************************************************************
+ * File: port_stm32f103.c
+ * @brief: This file contains the STM32F103 backend of the Port module: pin numbering,
+ *         CRL / CRH / ODR register images and single pin register accesses.
+ *
+ * Author: Farah Ahmed
+ * Date: April 5, 2024
+ *
+ * AUTOSAR Version: 3.2.0
+ * Target MCU: STM32F103
+ ********************************************************************************/
+#include "port_private.h"
+#include "common_macros.h"
+#include "port_regs.h"
+#include "port.h"
+
+#if (PORT_BACKEND == PORT_BACKEND_STM32F103)
+
+/*******************************************************************************
+ *                      Global Variables                                       *
+ *******************************************************************************/
+
+/* Base address of each port */
+volatile uint32 * const Port_BaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+    (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS,
+    (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS,
+    (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS
+};
+
+/* Offset of each register of Port_ImageRegister */
+const uint16 Port_ImageRegOffset[PORT_IMAGE_REGISTERS] =
+{
+    PORT_ODR_REG_OFFSET,
+    PORT_CRL_REG_OFFSET,
+    PORT_CRH_REG_OFFSET
+};
+
+/**
+ * @brief: Retrieves the port number of a given pin ID.
+ *
+ * @param copy_pinId: The ID of the pin.
+ * @return: The port number of the specified pin.
+ */
+uint8 Port_GetNumber(uint8 copy_pinId)
+{
+    return copy_pinId / 16;
+}
+
+/**
+ * @brief: Retrieves the pin number of a given port number and pin ID.
+ *
+ * @param copy_portNum: The port number.
+ * @param copy_pinId: The ID of the pin.
+ * @return: The pin number of the specified port and pin ID.
+ */
+uint8 Pin_GetNumber(uint8 copy_portNum, uint8 copy_pinId)
+{
+    return copy_pinId - (copy_portNum * 16);
+}
+
+/**
+ * @brief: Retrieves the CRL / CRH register holding the field of a pin and the position of the field.
+ *
+ * @param copy_pinNum: The pin number inside the port.
+ * @param copy_shift: Receives the position of the 4-bit field of the pin in the register.
+ * @return: PORT_IMAGE_CRL or PORT_IMAGE_CRH.
+ */
+static Port_ImageRegister Port_GetConfigRegister(uint8 copy_pinNum, uint8 *copy_shift)
+{
+    *copy_shift = (copy_pinNum % PORT_PINS_PER_CR_REG) * PORT_CR_FIELD_WIDTH;
+
+    return (copy_pinNum < PORT_PINS_PER_CR_REG) ? PORT_IMAGE_CRL : PORT_IMAGE_CRH;
+}
+
+/**
+ * @brief: Computes the CRL / CRH / ODR images of all ports from the configuration array.
+ *         The 4-bit CNF / MODE field of every pin is packed into whole CRL and CRH words,
+ *         ODR holds the initial level of the outputs and the pull direction of the inputs.
+ *         Disabled pins are inputs with pull-up, like the default pins of the TM4C backend.
+ *
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images to be filled.
+ */
+void Port_BuildImages(const Port_ChannelConfig *copy_config, Port_PortImageType *copy_images)
+{
+    uint8 port;
+    uint8 reg;
+    uint8 i;
+
+    for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            copy_images[port].reg[reg].value = 0;
+            copy_images[port].reg[reg].mask = 0;
+        }
+    }
+
+    for (i = 0; i < PORT_CONFIGURED_PINS; i++)
+    {
+        uint8 port_num = Port_GetNumber(copy_config[i].pin_id);
+        uint8 pin_num = Pin_GetNumber(port_num , copy_config[i].pin_id);
+        Port_RegImageType *image = copy_images[port_num].reg;
+        Port_RegImageType *odr = &image[PORT_IMAGE_ODR];
+        uint32 field;
+        uint8 shift;
+        Port_ImageRegister cr = Port_GetConfigRegister(pin_num , &shift);
+
+        if (copy_config[i].pin_enable == Enable)
+        {
+            field = PORT_CR_FIELD(copy_config[i].mode , copy_config[i].direction);
+
+            if (copy_config[i].direction != PORT_PIN_IN)
+            {
+                /* Output: ODR holds the initial value */
+                if (copy_config[i].initial_value == INITIAL_HIGH)
+                {
+                    SET_BIT(odr->value , pin_num);
+                    SET_BIT(odr->mask , pin_num);
+                }
+                else if (copy_config[i].initial_value == INITIAL_LOW)
+                {
+                    CLEAR_BIT(odr->value , pin_num);
+                    SET_BIT(odr->mask , pin_num);
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+            else if ((copy_config[i].mode == PULL_INPUT) && (copy_config[i].resistor != NONE))
+            {
+                /* Pulled input: ODR selects pull-up (1) or pull-down (0) */
+                if (copy_config[i].resistor == PULL_UP)
+                {
+                    SET_BIT(odr->value , pin_num);
+                }
+                else
+                {
+                    CLEAR_BIT(odr->value , pin_num);
+                }
+                SET_BIT(odr->mask , pin_num);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* default configuration: input with pull-up */
+            field = PORT_CR_FIELD(PULL_INPUT , PORT_PIN_IN);
+            SET_BIT(odr->value , pin_num);
+            SET_BIT(odr->mask , pin_num);
+        }
+
+        image[cr].value = (image[cr].value & ~(PORT_CR_FIELD_MASK << shift)) | (field << shift);
+        image[cr].mask |= (PORT_CR_FIELD_MASK << shift);
+    }
+}
+
+/**
+ * @brief: Extends the images of a configuration so that every configured pin is set whole.
+ *         Port_BuildImages already writes the whole CRL / CRH field of every configured pin
+ *         and ODR holds output levels and pull directions, so there is nothing to add.
+ * 
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images of copy_config to be completed.
+ */
+void Port_CompleteImages(const Port_ChannelConfig *copy_config, Port_PortImageType *copy_images)
+{
+    (void)copy_config;
+    (void)copy_images;
+}
+
+/**
+ * @brief: Writes the CRL / CRH / ODR images of all ports. ODR goes first so that the
+ *         outputs start at their initial level and the pull direction is set before the
+ *         pins change mode. A register whose fields are all configured is written with
+ *         a single store, the others with one read-modify-write.
+ *
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images.
+ */
+void Port_WriteImages(const Port_PortImageType *copy_images)
+{
+    uint8 port;
+    uint8 reg;
+
+    for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        volatile uint32 *base = Port_BaseAddress[port];
+
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            const Port_RegImageType *image = &copy_images[port].reg[reg];
+            uint16 offset = Port_ImageRegOffset[reg];
+
+            if (image->mask == 0xFFFFFFFFUL)
+            {
+                PORT_REG_WRITE(base , offset , image->value);
+            }
+            else if (image->mask != 0)
+            {
+                PORT_REG_WRITE(base , offset , (PORT_REG(base , offset) & ~image->mask) | image->value);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+}
+
+/**
+ * @brief: Computes the bits of every register that Port_VerifyImages may check. The ODR bits of
+ *         the outputs are their levels driven by the Dio driver and are not checked, only the
+ *         pull selection of the inputs is. The MODE[1:0] bits of pins with d_ch on and the
+ *         CNF[1:0] bits of pins with m_ch on are left out as Port_SetPinDirection /
+ *         Port_SetPinMode may change them, and so is the ODR bit of both kinds of pins.
+ *
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_masks: The PORT_NUMBER_OF_PORTS verify masks to be filled.
+ */
+void Port_BuildVerifyMasks(const Port_ChannelConfig *copy_config, Port_VerifyMaskType *copy_masks)
+{
+    uint8 port;
+    uint8 reg;
+    uint8 i;
+
+    for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            copy_masks[port].check[reg] = 0xFFFFFFFFUL;
+        }
+    }
+
+    for (i = 0; i < PORT_CONFIGURED_PINS; i++)
+    {
+        uint8 port_num = Port_GetNumber(copy_config[i].pin_id);
+        uint8 pin_num = Pin_GetNumber(port_num , copy_config[i].pin_id);
+        uint32 *check = copy_masks[port_num].check;
+        uint8 shift;
+        Port_ImageRegister cr = Port_GetConfigRegister(pin_num , &shift);
+
+        if (((copy_config[i].pin_enable == Enable) && (copy_config[i].direction != PORT_PIN_IN))
+            || (copy_config[i].d_ch == STD_ON) || (copy_config[i].m_ch == STD_ON))
+        {
+            CLEAR_BIT(check[PORT_IMAGE_ODR] , pin_num);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if (copy_config[i].d_ch == STD_ON)
+        {
+            check[cr] &= ~(PORT_CR_MODE_MASK << shift);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if (copy_config[i].m_ch == STD_ON)
+        {
+            check[cr] &= ~(PORT_CR_MODE_MASK << (shift + PORT_CR_CNF_SHIFT));
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief: Retrieves the pins owning the CRL / CRH fields that have at least one bit set.
+ *
+ * @param copy_fields: Bits of a CRL / CRH register.
+ * @param copy_reg: PORT_IMAGE_CRL or PORT_IMAGE_CRH.
+ * @return: One bit per pin of the port.
+ */
+static uint32 Port_ConfigFieldsToPins(uint32 copy_fields, Port_ImageRegister copy_reg)
+{
+    uint32 pins = 0;
+    uint8 field;
+
+    for (field = 0; field < PORT_PINS_PER_CR_REG; field++)
+    {
+        if (((copy_fields >> (field * PORT_CR_FIELD_WIDTH)) & PORT_CR_FIELD_MASK) != 0)
+        {
+            SET_BIT(pins , field);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return (copy_reg == PORT_IMAGE_CRH) ? (pins << PORT_PINS_PER_CR_REG) : pins;
+}
+
+/**
+ * @brief: Reads every checked register of every port once and compares it with its image.
+ *         A register with wrong bits is repaired by writing back the value read with these
+ *         bits flipped.
+ *
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images expected in the registers (configuration
+ *                     or profile), only the bits they write are checked.
+ * @param copy_masks: The PORT_NUMBER_OF_PORTS verify masks.
+ * @param copy_repair: TRUE to rewrite the registers that do not match.
+ * @return: PORT_PIN_MASK(pin id) set for every pin with at least one wrong checked bit.
+ */
+Port_PinMaskType Port_VerifyImages(const Port_PortImageType *copy_images, const Port_VerifyMaskType *copy_masks,
+                                   boolean copy_repair)
+{
+    Port_PinMaskType corrupted = 0;
+    uint8 port;
+    uint8 reg;
+
+    for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        volatile uint32 *base = Port_BaseAddress[port];
+        uint32 pins = 0;
+
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            uint32 check = copy_masks[port].check[reg] & copy_images[port].reg[reg].mask;
+
+            if (check != 0)
+            {
+                uint16 offset = Port_ImageRegOffset[reg];
+                uint32 current = PORT_REG(base , offset);
+                uint32 wrong = (current ^ copy_images[port].reg[reg].value) & check;
+
+                if (wrong != 0)
+                {
+                    pins |= (reg == PORT_IMAGE_ODR) ? wrong : Port_ConfigFieldsToPins(wrong , (Port_ImageRegister)reg);
+
+                    if (copy_repair == TRUE)
+                    {
+                        PORT_REG_WRITE(base , offset , current ^ wrong);
+                    }
+                    else
+                    {
+                        /* Do Nothing */
+                    }
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        /* pin id = port * 16 + pin */
+        corrupted |= ((Port_PinMaskType)pins) << (port * 16);
+    }
+
+    return corrupted;
+}
+
+/**
+ * @brief: Changes the direction of one pin through the MODE[1:0] bits of its CRL / CRH field,
+ *         the CNF[1:0] bits set by Port_SetPinMode are kept.
+ *
+ * @param copy_pinId: The ID of the pin.
+ * @param copy_direction: The new direction of the pin (input or output speed).
+ */
+void Port_WritePinDirection(uint8 copy_pinId, Port_PinDirectionType copy_direction)
+{
+    uint8 port_num = Port_GetNumber(copy_pinId);
+    uint8 pin_num = Pin_GetNumber(port_num , copy_pinId);
+    uint8 shift;
+    Port_ImageRegister cr = Port_GetConfigRegister(pin_num , &shift);
+    volatile uint32 *reg_ptr = &PORT_REG(Port_BaseAddress[port_num] , Port_ImageRegOffset[cr]);
+
+    *reg_ptr = (*reg_ptr & ~(PORT_CR_MODE_MASK << shift)) | (((uint32)copy_direction & PORT_CR_MODE_MASK) << shift);
+}
+
+/**
+ * @brief: Changes the mode of one pin through the CNF[1:0] bits of its CRL / CRH field,
+ *         the MODE[1:0] bits set by Port_SetPinDirection are kept.
+ *
+ * @param copy_pinId: The ID of the pin.
+ * @param copy_mode: The new mode of the pin.
+ */
+void Port_WritePinMode(uint8 copy_pinId, Port_PinModeType copy_mode)
+{
+    uint8 port_num = Port_GetNumber(copy_pinId);
+    uint8 pin_num = Pin_GetNumber(port_num , copy_pinId);
+    uint8 shift;
+    Port_ImageRegister cr = Port_GetConfigRegister(pin_num , &shift);
+    volatile uint32 *reg_ptr = &PORT_REG(Port_BaseAddress[port_num] , Port_ImageRegOffset[cr]);
+
+    shift += PORT_CR_CNF_SHIFT;
+    *reg_ptr = (*reg_ptr & ~(PORT_CR_MODE_MASK << shift)) | (((uint32)copy_mode & PORT_CR_MODE_MASK) << shift);
+}
+
+#endif /* PORT_BACKEND == PORT_BACKEND_STM32F103 */
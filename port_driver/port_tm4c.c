@@ -0,0 +1,621 @@
+/*********************************************************************************
+ * File: port_tm4c.c
+ * @brief: This file contains the TM4C backend of the Port module: pin numbering,
+ *         register images and single pin register accesses.
+ * 
+ * Author: Farah Ahmed
+ * Date: April 5, 2024
+ * 
+ * AUTOSAR Version: 3.2.0
+ * Target MCU: TIVAC123GH6PM
+ ********************************************************************************/
+#include "port_private.h"
+#include "common_macros.h"
+#include "port_regs.h"
+#include "port.h"
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+
+/*******************************************************************************
+ *                      Global Variables                                       *
+ *******************************************************************************/
+
+/* Base address of each port */
+volatile uint32 * const Port_BaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+    (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS,
+    (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS,
+    (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS,
+    (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS,
+    (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS,
+    (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Offset of each register of Port_ImageRegister */
+const uint16 Port_ImageRegOffset[PORT_IMAGE_REGISTERS] =
+{
+    PORT_DATA_REG_OFFSET,
+    PORT_DIR_REG_OFFSET,
+    PORT_CTL_REG_OFFSET,
+    PORT_ALT_FUNC_REG_OFFSET,
+    PORT_PULL_UP_REG_OFFSET,
+    PORT_PULL_DOWN_REG_OFFSET,
+    PORT_DIGITAL_ENABLE_REG_OFFSET,
+    PORT_ANALOG_MODE_SEL_REG_OFFSET
+};
+
+/* Pin id of pin 0 of each port, PC0..PC3 have no pin id */
+static const uint8 Port_PinIdBase[PORT_NUMBER_OF_PORTS] = { 0 , 8 , 16 , 24 , 32 , 38 };
+
+/**
+ * @brief: Sets or clears one bit of a register image and marks it as written.
+ * 
+ * @param copy_image: The register image.
+ * @param copy_pinNum: The pin number inside the port.
+ * @param copy_level: STD_HIGH to set the bit, STD_LOW to clear it.
+ */
+static void Port_ImageWriteBit(Port_RegImageType *copy_image, uint8 copy_pinNum, uint8 copy_level)
+{
+    if (copy_level == STD_HIGH)
+    {
+        SET_BIT(copy_image->value , copy_pinNum);
+    }
+    else
+    {
+        CLEAR_BIT(copy_image->value , copy_pinNum);
+    }
+    SET_BIT(copy_image->mask , copy_pinNum);
+}
+
+/**
+ * @brief: Retrieves the GPIOPCTL field of a mode, analog pins use no digital function.
+ * 
+ * @param copy_mode: The mode of the pin.
+ * @return: The PMC value of the mode.
+ */
+static uint32 Port_GetPctlValue(Port_PinModeType copy_mode)
+{
+    return (copy_mode == ADC_Mode) ? (uint32)Gpio_Mode : ((uint32)copy_mode & PORT_PCTL_FIELD_MASK);
+}
+
+/**
+ * @brief: Replaces the GPIOPCTL field of one pin in a register image and marks it as written.
+ * 
+ * @param copy_image: The GPIOPCTL register image.
+ * @param copy_pinNum: The pin number inside the port.
+ * @param copy_mode: The mode of the pin.
+ */
+static void Port_ImageWritePctl(Port_RegImageType *copy_image, uint8 copy_pinNum, Port_PinModeType copy_mode)
+{
+    uint8 shift = copy_pinNum * PORT_PCTL_FIELD_WIDTH;
+
+    copy_image->value = (copy_image->value & ~(PORT_PCTL_FIELD_MASK << shift)) | (Port_GetPctlValue(copy_mode) << shift);
+    copy_image->mask |= (PORT_PCTL_FIELD_MASK << shift);
+}
+
+/**
+ * @brief: Retrieves the port number of a given pin ID.
+ * 
+ * @param copy_pinId: The ID of the pin.
+ * @return: The port number of the specified pin.
+ */
+
+
+uint8 Port_GetNumber(uint8 copy_pinId)
+{
+    if (copy_pinId <= 7)
+    {
+        return PORTA;
+    }
+
+    if (copy_pinId >= 8 && copy_pinId <= 15)
+    {
+        return PORTB;
+    }
+
+    if (copy_pinId >= 20 && copy_pinId <= 23)
+    {
+        return PORTC;
+    }
+
+    if (copy_pinId >= 24 && copy_pinId <= 31)
+    {
+        return PORTD;
+    }
+
+    if (copy_pinId >= 32 && copy_pinId <= 37)
+    {
+        return PORTE;
+    }
+
+    if (copy_pinId >= 38 && copy_pinId <= 42)
+    {
+        return PORTF;
+    }
+
+    return 0 ;
+}
+
+/**
+ * @brief: Retrieves the pin number of a given port number and pin ID.
+ * 
+ * @param copy_portNum: The port number.
+ * @param copy_pinId: The ID of the pin.
+ * @return: The pin number of the specified port and pin ID.
+ */
+uint8 Pin_GetNumber(uint8 copy_portNum, uint8 copy_pinId)
+{
+    uint8 number = 0;
+    switch (copy_portNum)
+    {
+    case PORTA:
+        number = copy_pinId;
+        break;
+    case PORTB:
+        number = copy_pinId - 8;
+        break;
+    case PORTC:
+        number = copy_pinId - 16;
+        break;
+    case PORTD:
+        number = copy_pinId - 24;
+        break;
+    case PORTE:
+        number = copy_pinId - 32;
+        break;
+    case PORTF:
+        number = copy_pinId - 38;
+        break;
+    }
+    return number;
+}
+
+/**
+ * @brief: Computes the register images of all ports from the configuration array.
+ *         Each pin updates its bit in the images exactly like the per pin register
+ *         accesses of Port_Init used to, the registers themselves are not touched.
+ * 
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images to be filled.
+ */
+void Port_BuildImages(const Port_ChannelConfig *copy_config, Port_PortImageType *copy_images)
+{
+    uint8 port;
+    uint8 reg;
+    uint8 i;
+
+    for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            copy_images[port].reg[reg].value = 0;
+            copy_images[port].reg[reg].mask = 0;
+        }
+        copy_images[port].commit = 0;
+    }
+
+    for (i = 0; i < PORT_CONFIGURED_PINS; i++)
+    {
+        uint8 port_num = Port_GetNumber(copy_config[i].pin_id);
+        uint8 pin_num = Pin_GetNumber(port_num , copy_config[i].pin_id);
+        Port_RegImageType *image = copy_images[port_num].reg;
+
+        /* PD7 and PF0 are locked, changes need their GPIOCR bit */
+        if (((port_num == PORTD) && (pin_num == 7)) || ((port_num == PORTF) && (pin_num == 0)))
+        {
+            SET_BIT(copy_images[port_num].commit , pin_num);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if (copy_config[i].pin_enable == Disable)
+        {
+            /* default configuration: input with pull-up, no alternative function */
+            Port_ImageWriteBit(&image[PORT_IMAGE_DIR] , pin_num , STD_LOW);
+            Port_ImageWriteBit(&image[PORT_IMAGE_PUR] , pin_num , STD_HIGH);
+            Port_ImageWriteBit(&image[PORT_IMAGE_AFSEL] , pin_num , STD_LOW);
+            Port_ImageWritePctl(&image[PORT_IMAGE_PCTL] , pin_num , Gpio_Mode);
+        }
+        else if (copy_config[i].pin_enable == Enable)
+        {
+            if (copy_config[i].direction == PORT_PIN_OUT)
+            {
+                Port_ImageWriteBit(&image[PORT_IMAGE_DIR] , pin_num , STD_HIGH);
+
+                if (copy_config[i].initial_value == INITIAL_HIGH)
+                {
+                    Port_ImageWriteBit(&image[PORT_IMAGE_DATA] , pin_num , STD_HIGH);
+                }
+                else if (copy_config[i].initial_value == INITIAL_LOW)
+                {
+                    Port_ImageWriteBit(&image[PORT_IMAGE_DATA] , pin_num , STD_LOW);
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+            else if (copy_config[i].direction == PORT_PIN_IN)
+            {
+                Port_ImageWriteBit(&image[PORT_IMAGE_DIR] , pin_num , STD_LOW);
+
+                if (copy_config[i].resistor == PULL_UP)
+                {
+                    Port_ImageWriteBit(&image[PORT_IMAGE_PUR] , pin_num , STD_HIGH);
+                }
+                else if (copy_config[i].resistor == PULL_DOWN)
+                {
+                    Port_ImageWriteBit(&image[PORT_IMAGE_PDR] , pin_num , STD_HIGH);
+                }
+                else
+                {
+                    Port_ImageWriteBit(&image[PORT_IMAGE_PUR] , pin_num , STD_LOW);
+                    Port_ImageWriteBit(&image[PORT_IMAGE_PDR] , pin_num , STD_LOW);
+                }
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            /* alternative function for every mode other than Gpio_Mode, selected by the GPIOPCTL field */
+            Port_ImageWriteBit(&image[PORT_IMAGE_AFSEL] , pin_num ,
+                               (copy_config[i].mode != Gpio_Mode) ? STD_HIGH : STD_LOW);
+            Port_ImageWritePctl(&image[PORT_IMAGE_PCTL] , pin_num , copy_config[i].mode);
+
+            /* analog pins have the digital function disabled */
+            if (copy_config[i].mode == ADC_Mode)
+            {
+                Port_ImageWriteBit(&image[PORT_IMAGE_AMSEL] , pin_num , STD_HIGH);
+                Port_ImageWriteBit(&image[PORT_IMAGE_DEN] , pin_num , STD_LOW);
+            }
+            else
+            {
+                Port_ImageWriteBit(&image[PORT_IMAGE_DEN] , pin_num , STD_HIGH);
+                Port_ImageWriteBit(&image[PORT_IMAGE_AMSEL] , pin_num , STD_LOW);
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief: Extends the images of a configuration so that every configured pin is set whole.
+ *         GPIODATA is left to the output levels, every other bit not written is 0 at reset
+ *         and its value in the image is already 0.
+ * 
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images of copy_config to be completed.
+ */
+void Port_CompleteImages(const Port_ChannelConfig *copy_config, Port_PortImageType *copy_images)
+{
+    uint8 reg;
+    uint8 i;
+
+    for (i = 0; i < PORT_CONFIGURED_PINS; i++)
+    {
+        uint8 port_num = Port_GetNumber(copy_config[i].pin_id);
+        uint8 pin_num = Pin_GetNumber(port_num , copy_config[i].pin_id);
+        Port_RegImageType *image = copy_images[port_num].reg;
+
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            if (reg == PORT_IMAGE_PCTL)
+            {
+                image[reg].mask |= (PORT_PCTL_FIELD_MASK << (pin_num * PORT_PCTL_FIELD_WIDTH));
+            }
+            else if (reg != PORT_IMAGE_DATA)
+            {
+                SET_BIT(image[reg].mask , pin_num);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+}
+
+/**
+ * @brief: Writes the register images of all ports. GPIOCR is unlocked first for the
+ *         locked pins, then every register with configured bits gets a single
+ *         read-modify-write keeping the bits outside its mask.
+ * 
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images.
+ */
+void Port_WriteImages(const Port_PortImageType *copy_images)
+{
+    uint8 port;
+    uint8 reg;
+
+    for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        volatile uint32 *base = Port_BaseAddress[port];
+
+        if (copy_images[port].commit != 0)
+        {
+            /* Unlock the GPIOCR register before allowing changes on the locked pins */
+            PORT_REG_WRITE(base , PORT_LOCK_REG_OFFSET , PORT_UNLOCK_VALUE);
+            PORT_REG_WRITE(base , PORT_COMMIT_REG_OFFSET , PORT_REG(base , PORT_COMMIT_REG_OFFSET) | copy_images[port].commit);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            const Port_RegImageType *image = &copy_images[port].reg[reg];
+
+            if (image->mask != 0)
+            {
+                uint16 offset = Port_ImageRegOffset[reg];
+                PORT_REG_WRITE(base , offset , (PORT_REG(base , offset) & ~image->mask) | image->value);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+}
+
+/**
+ * @brief: Computes the bits of every register that Port_VerifyImages may check. GPIODATA holds
+ *         the output levels driven by the Dio driver and is not checked, GPIODIR bits of pins
+ *         with d_ch on and the GPIOPCTL / GPIOAFSEL / GPIODEN / GPIOAMSEL bits of pins with
+ *         m_ch on are left out as Port_SetPinDirection / Port_SetPinMode may change them.
+ *
+ * @param copy_config: The configuration array of PORT_CONFIGURED_PINS pins.
+ * @param copy_masks: The PORT_NUMBER_OF_PORTS verify masks to be filled.
+ */
+void Port_BuildVerifyMasks(const Port_ChannelConfig *copy_config, Port_VerifyMaskType *copy_masks)
+{
+    uint8 port;
+    uint8 reg;
+    uint8 i;
+
+    for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            copy_masks[port].check[reg] = 0xFFFFFFFFUL;
+        }
+        copy_masks[port].check[PORT_IMAGE_DATA] = 0;
+    }
+
+    for (i = 0; i < PORT_CONFIGURED_PINS; i++)
+    {
+        uint8 port_num = Port_GetNumber(copy_config[i].pin_id);
+        uint8 pin_num = Pin_GetNumber(port_num , copy_config[i].pin_id);
+        uint32 *check = copy_masks[port_num].check;
+
+        if (copy_config[i].d_ch == STD_ON)
+        {
+            CLEAR_BIT(check[PORT_IMAGE_DIR] , pin_num);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if (copy_config[i].m_ch == STD_ON)
+        {
+            check[PORT_IMAGE_PCTL] &= ~(PORT_PCTL_FIELD_MASK << (pin_num * PORT_PCTL_FIELD_WIDTH));
+            CLEAR_BIT(check[PORT_IMAGE_AFSEL] , pin_num);
+            CLEAR_BIT(check[PORT_IMAGE_DEN] , pin_num);
+            CLEAR_BIT(check[PORT_IMAGE_AMSEL] , pin_num);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief: Retrieves the pins owning the GPIOPCTL fields that have at least one bit set.
+ *
+ * @param copy_fields: Bits of a GPIOPCTL register.
+ * @return: One bit per pin of the port.
+ */
+static uint32 Port_PctlFieldsToPins(uint32 copy_fields)
+{
+    uint32 pins = 0;
+    uint8 pin_num;
+
+    for (pin_num = 0; pin_num < PORT_PINS_PER_PORT; pin_num++)
+    {
+        if (((copy_fields >> (pin_num * PORT_PCTL_FIELD_WIDTH)) & PORT_PCTL_FIELD_MASK) != 0)
+        {
+            SET_BIT(pins , pin_num);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return pins;
+}
+
+/**
+ * @brief: Reads every checked register of every port once and compares it with its image.
+ *         A register with wrong bits is repaired by writing back the value read with these
+ *         bits flipped, GPIOCR is opened first on the ports holding PD7 / PF0.
+ *
+ * @param copy_images: The PORT_NUMBER_OF_PORTS port images expected in the registers (configuration
+ *                     or profile), only the bits they write are checked.
+ * @param copy_masks: The PORT_NUMBER_OF_PORTS verify masks.
+ * @param copy_repair: TRUE to rewrite the registers that do not match.
+ * @return: PORT_PIN_MASK(pin id) set for every pin with at least one wrong checked bit.
+ */
+Port_PinMaskType Port_VerifyImages(const Port_PortImageType *copy_images, const Port_VerifyMaskType *copy_masks,
+                                   boolean copy_repair)
+{
+    Port_PinMaskType corrupted = 0;
+    uint8 port;
+    uint8 reg;
+
+    for (port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        volatile uint32 *base = Port_BaseAddress[port];
+        uint32 pins = 0;
+
+        for (reg = 0; reg < PORT_IMAGE_REGISTERS; reg++)
+        {
+            uint32 check = copy_masks[port].check[reg] & copy_images[port].reg[reg].mask;
+
+            if (check != 0)
+            {
+                uint16 offset = Port_ImageRegOffset[reg];
+                uint32 current = PORT_REG(base , offset);
+                uint32 wrong = (current ^ copy_images[port].reg[reg].value) & check;
+
+                if (wrong != 0)
+                {
+                    pins |= (reg == PORT_IMAGE_PCTL) ? Port_PctlFieldsToPins(wrong) : wrong;
+
+                    if (copy_repair == TRUE)
+                    {
+                        if (copy_images[port].commit != 0)
+                        {
+                            /* Unlock the GPIOCR register in case the locked pin is the wrong one */
+                            PORT_REG_WRITE(base , PORT_LOCK_REG_OFFSET , PORT_UNLOCK_VALUE);
+                            PORT_REG_WRITE(base , PORT_COMMIT_REG_OFFSET , PORT_REG(base , PORT_COMMIT_REG_OFFSET) | copy_images[port].commit);
+                        }
+                        else
+                        {
+                            /* Do Nothing */
+                        }
+                        PORT_REG_WRITE(base , offset , current ^ wrong);
+                    }
+                    else
+                    {
+                        /* Do Nothing */
+                    }
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        corrupted |= ((Port_PinMaskType)pins) << Port_PinIdBase[port];
+    }
+
+    return corrupted;
+}
+
+/**
+ * @brief: Unlocks GPIOCR for PD7 and PF0 so that their configuration can be changed.
+ * 
+ * @param copy_base: The base address of the port.
+ * @param copy_portNum: The port number.
+ * @param copy_pinNum: The pin number inside the port.
+ */
+static void Port_UnlockPin(volatile uint32 *copy_base, uint8 copy_portNum, uint8 copy_pinNum)
+{
+    if (((copy_portNum == PORTD) && (copy_pinNum == 7)) || ((copy_portNum == PORTF) && (copy_pinNum == 0)))
+    {
+        /* Unlock the GPIOCR register */
+        PORT_REG(copy_base , PORT_LOCK_REG_OFFSET) = PORT_UNLOCK_VALUE;
+        /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
+        SET_BIT(PORT_REG(copy_base , PORT_COMMIT_REG_OFFSET) , copy_pinNum);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief: Changes the direction of one pin through its GPIODIR bit.
+ * 
+ * @param copy_pinId: The ID of the pin.
+ * @param copy_direction: The new direction of the pin.
+ */
+void Port_WritePinDirection(uint8 copy_pinId, Port_PinDirectionType copy_direction)
+{
+    uint8 port_num = Port_GetNumber(copy_pinId);
+    uint8 pin_num = Pin_GetNumber(port_num , copy_pinId);
+    volatile uint32 *base = Port_BaseAddress[port_num];
+
+    Port_UnlockPin(base , port_num , pin_num);
+
+    if (copy_direction == PORT_PIN_OUT)
+    {
+        /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+        SET_BIT(PORT_REG(base , PORT_DIR_REG_OFFSET) , pin_num);
+    }
+    else if (copy_direction == PORT_PIN_IN)
+    {
+        /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+        CLEAR_BIT(PORT_REG(base , PORT_DIR_REG_OFFSET) , pin_num);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief: Changes the mode of one pin through its GPIOPCTL field and its GPIOAFSEL, GPIODEN
+ *         and GPIOAMSEL bits.
+ * 
+ * @param copy_pinId: The ID of the pin.
+ * @param copy_mode: The new mode of the pin.
+ */
+void Port_WritePinMode(uint8 copy_pinId, Port_PinModeType copy_mode)
+{
+    uint8 port_num = Port_GetNumber(copy_pinId);
+    uint8 pin_num = Pin_GetNumber(port_num , copy_pinId);
+    volatile uint32 *base = Port_BaseAddress[port_num];
+
+    uint8 shift = pin_num * PORT_PCTL_FIELD_WIDTH;
+
+    Port_UnlockPin(base , port_num , pin_num);
+
+    /* Select the function of the pin in its GPIOPCTL field before enabling it */
+    PORT_REG(base , PORT_CTL_REG_OFFSET) = (PORT_REG(base , PORT_CTL_REG_OFFSET) & ~(PORT_PCTL_FIELD_MASK << shift))
+                                         | (Port_GetPctlValue(copy_mode) << shift);
+
+    /* Check if Mode is different from Gpio_Mode */
+    if (copy_mode != Gpio_Mode)
+    {
+        /* Set alternative function */
+        SET_BIT(PORT_REG(base , PORT_ALT_FUNC_REG_OFFSET) , pin_num);
+    }
+    else
+    {
+        /* Clear alternative function */
+        CLEAR_BIT(PORT_REG(base , PORT_ALT_FUNC_REG_OFFSET) , pin_num);
+    }
+
+    if (copy_mode == ADC_Mode)
+    {
+        /* Enable analog register */
+        SET_BIT(PORT_REG(base , PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_num);
+        /* Disable digital register */
+        CLEAR_BIT(PORT_REG(base , PORT_DIGITAL_ENABLE_REG_OFFSET) , pin_num);
+    }
+    else
+    {
+        /* Enable digital register */
+        SET_BIT(PORT_REG(base , PORT_DIGITAL_ENABLE_REG_OFFSET) , pin_num);
+        /* Disable analog register */
+        CLEAR_BIT(PORT_REG(base , PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_num);
+    }
+}
+
+#endif /* PORT_BACKEND == PORT_BACKEND_TM4C */
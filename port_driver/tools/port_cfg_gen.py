@@ -0,0 +1,580 @@
+#!/usr/bin/env python3
+"""
+Port configuration generator.
+
+Reads the pin description table of every Port backend (tools/port_pins_<backend>.txt)
+and writes port_PBCfg.c with, for each backend:
+  - the Port_Configuration structure (one row per pin of the backend),
+  - the register images of every port, precomputed exactly like Port_BuildImages,
+  - the Port_PinIndex pin id to configuration index table,
+  - the register images of every pin profile (Port_ProfileImages) for Port_ApplyProfile,
+  - static asserts on every value the generated data relies on (pin ids, modes,
+    directions, image layout, PORT_CONFIGURED_PINS, profile ids ...), so that the build
+    fails when a header no longer matches,
+  - static asserts comparing the row of every pin claimed with a role (claim UART1 TX=PA9)
+    with the pin, mode and direction the peripheral driver defines for it
+    (UART1_TX_PIN / _MODE / _DIRECTION in Uart_Cfg.h).
+
+Conflicting pin usage (unknown or duplicated pins, a pin claimed by two peripherals,
+a peripheral pin configured as general purpose output ...) is rejected here.
+
+Usage: python3 tools/port_cfg_gen.py [-o OUTPUT] [--check]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+DRIVER_DIR = os.path.dirname(TOOLS_DIR)
+
+RESISTORS = {"PULL_UP": 0, "PULL_DOWN": 1, "NONE": 2}
+INITIAL_VALUES = {"INITIAL_LOW": 0, "INITIAL_HIGH": 1, "NO_INITIAL": 2}
+SWITCHES = {"STD_OFF": 0, "STD_ON": 1}
+
+# Configuration header of the driver of each peripheral (name without its instance number)
+# defining <PERIPHERAL>_<ROLE>_PIN / _MODE / _DIRECTION for the claims with a role
+PERIPHERAL_HEADERS = {"UART": "Uart_Cfg.h"}
+
+
+class Pin(object):
+    """One row of Port_Configuration."""
+
+    def __init__(self, name, mode, direction, resistor, initial_value, dir_ch, mode_ch, enabled, comment=""):
+        self.name = name
+        self.mode = mode
+        self.direction = direction
+        self.resistor = resistor
+        self.initial_value = initial_value
+        self.dir_ch = dir_ch
+        self.mode_ch = mode_ch
+        self.enabled = enabled
+        self.comment = comment
+
+
+class Backend(object):
+    """Register layout and enum values of one Port backend, as defined by the C headers."""
+
+    key = None
+    macro = None
+    title = None
+    port_letters = ""
+    pin_id_count = 0
+    modes = {}
+    directions = {}
+    images = []
+    default_mode = None
+
+    def __init__(self):
+        self.pins = self.pin_ids()
+
+    def pin_ids(self):
+        raise NotImplementedError
+
+    def port_pin(self, pin_id):
+        raise NotImplementedError
+
+    def build_images(self, rows):
+        raise NotImplementedError
+
+    def check_claim(self, peripheral, pin):
+        raise NotImplementedError
+
+    def complete_images(self, images, rows):
+        """Profile images set every pin completely: the bits left unwritten take their reset value."""
+        return images
+
+    def new_images(self):
+        return [{"regs": [[0, 0] for _ in self.images], "commit": 0} for _ in self.port_letters]
+
+
+class Tm4cBackend(Backend):
+    key = "tm4c"
+    macro = "PORT_BACKEND_TM4C"
+    title = "TM4C"
+    port_letters = "ABCDEF"
+    pin_id_count = 43
+    modes = {
+        "Gpio_Mode": 0, "Uart_Mode": 1, "SSI_PORTD_Mode": 1, "Uart1_PortC_Mode": 2, "SSI_Mode": 2,
+        "CAN0_PORTF_Mode": 3, "I2C_Mode": 3, "M0PWM_Mode": 4, "M1PWM_Mode": 5, "IDX_Mode": 6,
+        "PHA_Mode": 6, "PHB_Mode": 6, "TXCCP_Mode": 7, "WTXCCP_Mode": 7, "CAN_Mode": 8,
+        "USB_Mode": 8, "NMI_Mode": 8, "ADC_Mode": 10,
+    }
+    directions = {"PORT_PIN_IN": 0, "PORT_PIN_OUT": 1}
+    images = ["DATA", "DIR", "PCTL", "AFSEL", "PUR", "PDR", "DEN", "AMSEL"]
+    default_mode = "Gpio_Mode"
+
+    def pin_ids(self):
+        # PC0..PC3 are JTAG pins and have no pin id
+        pins = {}
+        for letter, first_id, numbers in (("A", 0, range(8)), ("B", 8, range(8)), ("C", 16, range(4, 8)),
+                                          ("D", 24, range(8)), ("E", 32, range(6)), ("F", 38, range(5))):
+            for number in numbers:
+                pins["P%s%d" % (letter, number)] = first_id + number
+        return pins
+
+    def port_pin(self, pin_id):
+        for port, (first, last, base) in enumerate(((0, 7, 0), (8, 15, 8), (20, 23, 16),
+                                                   (24, 31, 24), (32, 37, 32), (38, 42, 38))):
+            if first <= pin_id <= last:
+                return port, pin_id - base
+        raise ValueError(pin_id)
+
+    def build_images(self, rows):
+        images = self.new_images()
+        reg = dict((name, index) for index, name in enumerate(self.images))
+
+        def write_bit(image, number, level):
+            image[0] = (image[0] | (1 << number)) if level else (image[0] & ~(1 << number))
+            image[1] |= (1 << number)
+
+        def write_pctl(image, number, mode):
+            value = 0 if mode == "ADC_Mode" else (self.modes[mode] & 0xF)
+            image[0] = (image[0] & ~(0xF << (number * 4))) | (value << (number * 4))
+            image[1] |= (0xF << (number * 4))
+
+        for row in rows:
+            port, number = self.port_pin(self.pins[row.name])
+            regs = images[port]["regs"]
+            if (port, number) in ((3, 7), (5, 0)):
+                images[port]["commit"] |= (1 << number)
+            if not row.enabled:
+                write_bit(regs[reg["DIR"]], number, 0)
+                write_bit(regs[reg["PUR"]], number, 1)
+                write_bit(regs[reg["AFSEL"]], number, 0)
+                write_pctl(regs[reg["PCTL"]], number, "Gpio_Mode")
+                continue
+            if row.direction == "PORT_PIN_OUT":
+                write_bit(regs[reg["DIR"]], number, 1)
+                if row.initial_value != "NO_INITIAL":
+                    write_bit(regs[reg["DATA"]], number, row.initial_value == "INITIAL_HIGH")
+            else:
+                write_bit(regs[reg["DIR"]], number, 0)
+                if row.resistor == "PULL_UP":
+                    write_bit(regs[reg["PUR"]], number, 1)
+                elif row.resistor == "PULL_DOWN":
+                    write_bit(regs[reg["PDR"]], number, 1)
+                else:
+                    write_bit(regs[reg["PUR"]], number, 0)
+                    write_bit(regs[reg["PDR"]], number, 0)
+            write_bit(regs[reg["AFSEL"]], number, self.modes[row.mode] != self.modes["Gpio_Mode"])
+            write_pctl(regs[reg["PCTL"]], number, row.mode)
+            analog = row.mode == "ADC_Mode"
+            write_bit(regs[reg["AMSEL"]], number, analog)
+            write_bit(regs[reg["DEN"]], number, not analog)
+        return images
+
+    def complete_images(self, images, rows):
+        # GPIODATA is left to the output levels, every other register bit not written is 0 at reset
+        for row in rows:
+            port, number = self.port_pin(self.pins[row.name])
+            for index, name in enumerate(self.images):
+                if name == "PCTL":
+                    images[port]["regs"][index][1] |= (0xF << (number * 4))
+                elif name != "DATA":
+                    images[port]["regs"][index][1] |= (1 << number)
+        return images
+
+    def check_claim(self, peripheral, pin):
+        if pin.mode == "Gpio_Mode" or pin.mode == "ADC_Mode":
+            return "%s is claimed by %s but configured as %s" % (pin.name, peripheral, pin.mode)
+        return None
+
+
+class Stm32f103Backend(Backend):
+    key = "stm32f103"
+    macro = "PORT_BACKEND_STM32F103"
+    title = "STM32F103"
+    port_letters = "ABC"
+    pin_id_count = 48
+    modes = {
+        "ANALOG_INPUT": 0, "FLOATING_INPUT": 1, "PULL_INPUT": 2,
+        "GP_OPP": 0, "GP_OOD": 1, "AF_OPP": 2, "AF_OOD": 3,
+        "Gpio_Mode": 0, "ADC_Mode": 0,
+    }
+    directions = {"PORT_PIN_IN": 0, "PORT_PIN_OUT_10MHz": 1, "PORT_PIN_OUT_2MHz": 2, "PORT_PIN_OUT_50MHz": 3}
+    images = ["ODR", "CRL", "CRH"]
+    default_mode = "PULL_INPUT"
+
+    def pin_ids(self):
+        # PA13 / PA14 are SWD pins and have no pin id
+        pins = {}
+        for letter, port, numbers in (("A", 0, list(range(13)) + [15]), ("B", 1, range(16)), ("C", 2, range(13, 16))):
+            for number in numbers:
+                pins["P%s%d" % (letter, number)] = port * 16 + number
+        return pins
+
+    def port_pin(self, pin_id):
+        return pin_id // 16, pin_id % 16
+
+    def build_images(self, rows):
+        images = self.new_images()
+        odr_index = self.images.index("ODR")
+
+        for row in rows:
+            port, number = self.port_pin(self.pins[row.name])
+            regs = images[port]["regs"]
+            odr = regs[odr_index]
+            if row.enabled:
+                field = (self.modes[row.mode] << 2) | self.directions[row.direction]
+                if row.direction != "PORT_PIN_IN":
+                    if row.initial_value != "NO_INITIAL":
+                        odr[0] = (odr[0] | (1 << number)) if row.initial_value == "INITIAL_HIGH" \
+                            else (odr[0] & ~(1 << number))
+                        odr[1] |= (1 << number)
+                elif row.mode == "PULL_INPUT" and row.resistor != "NONE":
+                    odr[0] = (odr[0] | (1 << number)) if row.resistor == "PULL_UP" else (odr[0] & ~(1 << number))
+                    odr[1] |= (1 << number)
+            else:
+                field = (self.modes["PULL_INPUT"] << 2) | self.directions["PORT_PIN_IN"]
+                odr[0] |= (1 << number)
+                odr[1] |= (1 << number)
+            cr = regs[self.images.index("CRL" if number < 8 else "CRH")]
+            shift = (number % 8) * 4
+            cr[0] = (cr[0] & ~(0xF << shift)) | (field << shift)
+            cr[1] |= (0xF << shift)
+        return images
+
+    def check_claim(self, peripheral, pin):
+        if pin.direction != "PORT_PIN_IN" and pin.mode not in ("AF_OPP", "AF_OOD"):
+            return "%s is claimed by %s but configured as general purpose output %s" % (pin.name, peripheral, pin.mode)
+        if pin.direction == "PORT_PIN_IN" and pin.mode == "ANALOG_INPUT":
+            return "%s is claimed by %s but configured as analog input" % (pin.name, peripheral)
+        return None
+
+
+BACKENDS = [Tm4cBackend(), Stm32f103Backend()]
+
+
+def fail(path, line_number, message):
+    sys.stderr.write("%s:%d: error: %s\n" % (path, line_number, message))
+    sys.exit(1)
+
+
+def check_symbols(path, line_number, checks):
+    for value, allowed, what in checks:
+        if value not in allowed:
+            fail(path, line_number, "unknown %s %s" % (what, value))
+
+
+def parse_profiles(backend, path, rows, profile_lines):
+    """Returns the (name, rows) of every profile, in order of first use, built on top of the RUN rows."""
+    profiles = []
+    profile_rows = {}
+    index_of = dict((row.name, index) for index, row in enumerate(rows))
+    for line_number, fields in profile_lines:
+        if len(fields) < 4:
+            fail(path, line_number, "expected: profile NAME pin|* mode direction resistor initial_value")
+        name, target = fields[1], fields[2]
+        if name == "RUN":
+            fail(path, line_number, "the RUN profile is the configuration itself")
+        if not re.match(r"^[A-Z][A-Z0-9_]*$", name):
+            fail(path, line_number, "profile name %s is not an upper case identifier" % name)
+        if name not in profile_rows:
+            profile_rows[name] = list(rows)
+            profiles.append((name, profile_rows[name]))
+        if target != "*" and target not in backend.pins:
+            fail(path, line_number, "%s is not a pin of the %s backend" % (target, backend.title))
+        indexes = range(len(rows)) if target == "*" else [index_of[target]]
+
+        if fields[3:] == ["keep"]:
+            if target == "*":
+                fail(path, line_number, "keep needs a pin")
+            profile_rows[name][index_of[target]] = rows[index_of[target]]
+            continue
+        if len(fields) != 7:
+            fail(path, line_number, "expected: profile NAME pin|* mode direction resistor initial_value")
+        mode, direction, resistor, initial_value = fields[3:]
+        check_symbols(path, line_number, ((mode, backend.modes, "mode"), (direction, backend.directions, "direction"),
+                                          (resistor, RESISTORS, "resistor"),
+                                          (initial_value, INITIAL_VALUES, "initial value")))
+        for index in indexes:
+            profile_rows[name][index] = Pin(rows[index].name, mode, direction, resistor, initial_value,
+                                            "STD_OFF", "STD_OFF", True)
+    return profiles
+
+
+def parse_table(backend, path):
+    """Returns the rows of all the pins of the backend (in pin id order), the peripheral claims and the profiles."""
+    used = {}
+    claims = []
+    claimed_by = {}
+    profile_lines = []
+    with open(path) as table:
+        for line_number, line in enumerate(table, 1):
+            text, _, comment = line.partition("#")
+            fields = text.split()
+            if not fields:
+                continue
+            if fields[0] == "claim":
+                if len(fields) < 3:
+                    fail(path, line_number, "claim needs a peripheral and at least one pin")
+                for field in fields[2:]:
+                    role, _, name = field.rpartition("=")
+                    if role and peripheral_header(fields[1]) is None:
+                        fail(path, line_number, "%s has no driver configuration defining the pin of %s" % (fields[1], role))
+                    if name in claimed_by:
+                        fail(path, line_number, "%s is claimed by both %s and %s" % (name, claimed_by[name], fields[1]))
+                    claimed_by[name] = fields[1]
+                    claims.append((line_number, fields[1], role, name))
+                continue
+            if fields[0] == "profile":
+                profile_lines.append((line_number, fields))
+                continue
+            if len(fields) != 7:
+                fail(path, line_number, "expected: pin mode direction resistor initial_value dir_ch mode_ch")
+            name, mode, direction, resistor, initial_value, dir_ch, mode_ch = fields
+            if name not in backend.pins:
+                fail(path, line_number, "%s is not a pin of the %s backend" % (name, backend.title))
+            if name in used:
+                fail(path, line_number, "%s is already configured on line %d" % (name, used[name][0]))
+            check_symbols(path, line_number, ((mode, backend.modes, "mode"), (direction, backend.directions, "direction"),
+                                              (resistor, RESISTORS, "resistor"),
+                                              (initial_value, INITIAL_VALUES, "initial value"),
+                                              (dir_ch, SWITCHES, "dir_ch"), (mode_ch, SWITCHES, "mode_ch")))
+            used[name] = (line_number, Pin(name, mode, direction, resistor, initial_value, dir_ch, mode_ch, True,
+                                           comment.strip()))
+
+    for line_number, peripheral, _, name in claims:
+        if name not in used:
+            fail(path, line_number, "%s is claimed by %s but not configured" % (name, peripheral))
+        problem = backend.check_claim(peripheral, used[name][1])
+        if problem:
+            fail(path, line_number, problem)
+
+    rows = []
+    for name in sorted(backend.pins, key=lambda pin: backend.pins[pin]):
+        if name in used:
+            rows.append(used[name][1])
+        else:
+            rows.append(Pin(name, backend.default_mode, "PORT_PIN_IN", "PULL_UP", "NO_INITIAL", "STD_OFF", "STD_OFF",
+                            False))
+    return (rows, [(peripheral, role, used[name][1]) for _, peripheral, role, name in claims],
+            parse_profiles(backend, path, rows, profile_lines))
+
+
+def emit_images(backend, out, images, c_name, comment):
+    out.append("/* %s */" % comment)
+    out.append("STATIC const Port_PortImageType %s[PORT_NUMBER_OF_PORTS] =" % c_name)
+    out.append("{")
+    for port, letter in enumerate(backend.port_letters):
+        out.append("    /* PORT%s */" % letter)
+        out.append("    {")
+        out.append("        {")
+        for index, name in enumerate(backend.images):
+            value, mask = images[port]["regs"][index]
+            out.append("            { 0x%08XUL , 0x%08XUL }%s /* %s */"
+                       % (value, mask, "," if index + 1 < len(backend.images) else " ", name))
+        if backend is BACKENDS[0]:
+            out.append("        },")
+            out.append("        0x%08XUL /* commit */" % images[port]["commit"])
+        else:
+            out.append("        }")
+        out.append("    }%s" % ("," if port + 1 < len(backend.port_letters) else ""))
+    out.append("};")
+    out.append("")
+
+
+def profile_images_name(name):
+    return "Port_%sProfileImages" % "".join(part.capitalize() for part in name.split("_"))
+
+
+def peripheral_header(peripheral):
+    return PERIPHERAL_HEADERS.get(peripheral.rstrip("0123456789"))
+
+
+def emit_backend(backend, rows, claims, profiles, table_name):
+    out = []
+
+    out.append("#%s (PORT_BACKEND == %s)" % ("if" if backend is BACKENDS[0] else "elif", backend.macro))
+    out.append("")
+    out.append("/* Generated from tools/%s */" % table_name)
+    out.append("")
+
+    # Values the generated data relies on
+    out.append("/* The configuration below is only valid with the pin ids, modes and register layout it was generated for */")
+    out.append("PORT_STATIC_ASSERT(PORT_CONFIGURED_PINS == %d, configured_pins);" % len(rows))
+    out.append("PORT_STATIC_ASSERT(PORT_PIN_ID_COUNT == %dU, pin_id_count);" % backend.pin_id_count)
+    out.append("PORT_STATIC_ASSERT(PORT_NUMBER_OF_PORTS == %d, number_of_ports);" % len(backend.port_letters))
+    out.append("PORT_STATIC_ASSERT(PORT_IMAGE_REGISTERS == %d, image_registers);" % len(backend.images))
+    for index, name in enumerate(backend.images):
+        out.append("PORT_STATIC_ASSERT(PORT_IMAGE_%s == %d, image_%s);" % (name, index, name.lower()))
+    for row in rows:
+        out.append("PORT_STATIC_ASSERT(%s == %d, pin_%s);" % (row.name, backend.pins[row.name], row.name))
+    out.append("PORT_STATIC_ASSERT(PORT_NUMBER_OF_PROFILES == %dU, number_of_profiles);" % (len(profiles) + 1))
+    out.append("PORT_STATIC_ASSERT(PORT_PROFILE_RUN == 0U, profile_run);")
+    for index, (name, _) in enumerate(profiles, 1):
+        out.append("PORT_STATIC_ASSERT(PORT_PROFILE_%s == %dU, profile_%s);" % (name, index, name.lower()))
+    all_rows = rows + [row for _, profile_rows in profiles for row in profile_rows]
+    for name in sorted(set(row.mode for row in all_rows) | set(row.direction for row in all_rows)):
+        value = backend.modes[name] if name in backend.modes else backend.directions[name]
+        out.append("PORT_STATIC_ASSERT(%s == %d, %s);" % (name, value, name))
+    out.append("")
+
+    # Peripheral pins
+    checked = [(peripheral, role, pin) for peripheral, role, pin in claims if role]
+    if checked:
+        out.append("/* Pins claimed by peripherals: the row of the table is the pin, mode and direction")
+        out.append(" * the peripheral driver sets up */")
+        for peripheral, role, pin in checked:
+            out.append("PORT_STATIC_ASSERT((%s_%s_PIN == %s) && (%s_%s_MODE == %s) && (%s_%s_DIRECTION == %s), %s_%s_%s);"
+                       % (peripheral, role, pin.name, peripheral, role, pin.mode, peripheral, role, pin.direction,
+                          peripheral, role, pin.name))
+        out.append("")
+
+    # Register images
+    emit_images(backend, out, backend.build_images(rows), "Port_ConfigurationImages",
+                "Register images of Port_Configuration, written as they are by Port_Init")
+
+    # Configuration structure
+    out.append("/* PB structure used with Port_Init API */")
+    out.append("const Port_ConfigType Port_Configuration =")
+    out.append("{")
+    out.append("    {")
+    letter = None
+    for index, row in enumerate(rows):
+        if row.name[1] != letter:
+            if letter is not None:
+                out.append("")
+            letter = row.name[1]
+            out.append("        /* PORT%s */" % letter)
+        fields = [row.name, row.mode, row.direction, row.resistor, row.initial_value, row.dir_ch, row.mode_ch,
+                  "Enable" if row.enabled else "Disable"]
+        text = "        { %-5s, %-24s, %-26s, %-9s, %-12s, %-7s, %-7s, %-7s }%s" \
+               % tuple(fields + ["," if index + 1 < len(rows) else ""])
+        if row.comment:
+            text += " /* %s */" % row.comment
+        out.append(text.rstrip())
+    out.append("    },")
+    out.append("    Port_ConfigurationImages")
+    out.append("};")
+    out.append("")
+
+    # Pin index table
+    out.append("/* Pin id to configuration index table used by Port_SetPinDirection and Port_SetPinMode,")
+    out.append(" * each entry holds the index of the pin in Port_Configuration plus one so that pins without")
+    out.append(" * an entry stay PORT_PIN_NOT_CONFIGURED */")
+    out.append("const uint8 Port_PinIndex[PORT_PIN_ID_COUNT] =")
+    out.append("{")
+    for index, row in enumerate(rows):
+        out.append(" [%s]%s= %d%s" % (row.name, " " * (6 - len(row.name)), index + 1,
+                                      "," if index + 1 < len(rows) else ""))
+    out.append("};")
+    out.append("")
+
+    # Pin profiles
+    names = []
+    for name, profile_rows in [("RUN", rows)] + profiles:
+        images = backend.complete_images(backend.build_images(profile_rows), profile_rows)
+        if name == "RUN" and images == backend.build_images(rows):
+            # the configuration images already set every pin
+            names.append("Port_ConfigurationImages")
+            continue
+        names.append(profile_images_name(name))
+        emit_images(backend, out, images, names[-1],
+                    "Register images of the %s profile, every pin of the backend is set" % name)
+    out.append("/* Register images of every profile, indexed by the PORT_PROFILE_<NAME> ids */")
+    out.append("const Port_PortImageType * const Port_ProfileImages[PORT_NUMBER_OF_PROFILES] =")
+    out.append("{")
+    for index, c_name in enumerate(names):
+        out.append("    %s%s" % (c_name, "," if index + 1 < len(names) else ""))
+    out.append("};")
+    out.append("")
+    return out
+
+
+HEADER = """/******************************************************************
+ * File: port_PBCfg.c
+ * @brief: This file contains the post-build configuration structure for the Port module.
+ *
+ *         GENERATED FILE, do not edit: change the pin description tables in tools/
+ *         and run python3 tools/port_cfg_gen.py
+ *
+ * Author: Farah Ahmed
+ * Date: April 5, 2024
+ *
+ * AUTOSAR Version: 3.2.0
+ * Target MCU: TIVAC123GH6PM / STM32F103
+ ********************************************************************/
+
+#include "port.h"
+#include "port_regs.h"
+#include "port_private.h"
+
+/* Module version 1.0.0, initial release */
+#define PORT_PBCFG_SW_MAJOR_VERSION      (1)
+#define PORT_PBCFG_SW_MINOR_VERSION      (0)
+#define PORT_PBCFG_SW_PATCH_VERSION      (0)
+
+/* AUTOSAR version 4.0.3 */
+#define PORT_PBCFG_AR_RELEASE_MAJOR_VERSION      (4)
+#define PORT_PBCFG_AR_RELEASE_MINOR_VERSION      (0)
+#define PORT_PBCFG_AR_RELEASE_PATCH_VERSION      (3)
+
+/* AUTOSAR Version checking between port_PBCfg.c and port.h files */
+#if ((PORT_PBCFG_AR_RELEASE_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION) || \\
+     (PORT_PBCFG_AR_RELEASE_MINOR_VERSION != PORT_AR_RELEASE_MINOR_VERSION) || \\
+     (PORT_PBCFG_AR_RELEASE_PATCH_VERSION != PORT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of port_PBCfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between port_PBCfg.c and port.h files */
+#if ((PORT_PBCFG_SW_MAJOR_VERSION != PORT_SW_MAJOR_VERSION) || \\
+     (PORT_PBCFG_SW_MINOR_VERSION != PORT_SW_MINOR_VERSION) || \\
+     (PORT_PBCFG_SW_PATCH_VERSION != PORT_SW_PATCH_VERSION))
+  #error "The SW version of port_PBCfg.c does not match the expected version"
+#endif
+
+/*-------------------------------------------------------------------------------------*/
+
+#ifdef PORT_HOST_SIMULATION
+/* Register file standing for the GPIO ports in a host build */
+volatile uint32 Port_SimulatedPorts[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+/* Stores counted by PORT_REG_WRITE */
+uint32 Port_SimulatedStores[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+#endif
+"""
+
+
+def generate():
+    tables = []
+    includes = []
+    for backend in BACKENDS:
+        table_name = "port_pins_%s.txt" % backend.key
+        rows, claims, profiles = parse_table(backend, os.path.join(TOOLS_DIR, table_name))
+        tables.append((backend, rows, claims, profiles, table_name))
+        headers = sorted(set(peripheral_header(peripheral) for peripheral, role, _ in claims if role))
+        if headers:
+            includes.append("#if (PORT_BACKEND == %s)" % backend.macro)
+            includes.append("/* Pins of the peripheral drivers claiming pins of the table */")
+            includes.extend('#include "%s"' % header for header in headers)
+            includes.append("#endif")
+    out = [HEADER.replace("#include \"port_private.h\"\n",
+                          "\n".join(['#include "port_private.h"'] + includes) + "\n")]
+    for table in tables:
+        out.extend(emit_backend(*table))
+    out.append("#endif /* PORT_BACKEND */")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate port_PBCfg.c from the pin description tables")
+    parser.add_argument("-o", "--output", default=os.path.join(DRIVER_DIR, "port_PBCfg.c"))
+    parser.add_argument("--check", action="store_true", help="fail if the output is not up to date")
+    args = parser.parse_args()
+
+    text = generate()
+    if args.check:
+        with open(args.output) as current:
+            if current.read() != text:
+                sys.stderr.write("%s is not up to date, run %s\n" % (args.output, sys.argv[0]))
+                return 1
+        return 0
+    with open(args.output, "w") as output:
+        output.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
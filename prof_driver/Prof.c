@@ -0,0 +1,382 @@
+/**
+ * @file Prof.c
+ * @brief source file for the Profiling module.
+ *
+ * This file contains the definitions for the Profiling module. On target the probes run on
+ * the Cortex-M3 DWT cycle counter, a host build (PROF_HOST_SIMULATION) uses the x86 time
+ * stamp counter, or clock_gettime on other hosts, so the same probes can be used in unit tests.
+ *
+ * @copyright [Cairo Racing team -Formula students]
+ * @author [ Mohamed Mabrouk, Ahmed Yassin , Farah Ahmed]
+ * @date [17 0ct 2023]
+ *
+ * @SWversion 1.0.0
+ *
+ * @remarks
+ *    -Project          : AUTOSAR  R22-11 MCAL
+ *    -Platform         : ARM
+ *    -Peripherial      : STM32F103C8T6
+ *    -AUTOSAR Version  : NOT AVAILBLE
+ */
+ /*==================================================================================================================================*/
+/****************************************************************************
+*****************************  Includes   ***********************************
+*****************************************************************************/
+/* clock_gettime / CLOCK_MONOTONIC of the host build are POSIX.1b, hidden by a strict -std */
+#if defined(PROF_HOST_SIMULATION) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "Prof.h"
+#include "Det.h"
+
+#ifndef PROF_HOST_SIMULATION
+#include "Systick.h"
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+/*==================================================================================================================================*/
+
+/****************************************************************************
+*****************************  Global Variables   ***************************
+*****************************************************************************/
+
+/* Accumulated measurements of each probe */
+static Prof_StatsType Prof_Probes[PROF_NUM_OF_PROBES];
+
+ /*==================================================================================================================================*/
+/****************************************************************************
+*****************************  Local Functions   ****************************
+*****************************************************************************/
+
+/* Write the decimal representation of Value into Buffer, returns the number of characters */
+static uint8 Prof_FormatNumber(uint8* Buffer, uint64 Value)
+{
+    uint8 Digits[20];
+    uint8 Length = 0;
+    uint8 i;
+
+    do
+    {
+        Digits[Length++] = (uint8)('0' + (Value % 10));
+        Value /= 10;
+    } while (Value != 0);
+
+    /* digits were produced least significant first */
+    for (i = 0; i < Length; i++)
+    {
+        Buffer[i] = Digits[Length - 1 - i];
+    }
+    return Length;
+}
+
+/* Append a label and a number to Buffer, returns the new length */
+static uint8 Prof_AppendField(uint8* Buffer, uint8 Length, const char* Label, uint64 Value)
+{
+    while (*Label != '\0')
+    {
+        Buffer[Length++] = (uint8)*Label++;
+    }
+    return (uint8)(Length + Prof_FormatNumber(&Buffer[Length], Value));
+}
+
+ /*==================================================================================================================================*/
+/****************************************************************************
+*****************************  Functions Definition   ***************************
+*****************************************************************************/
+
+/**
+ * \section Service_Name
+ * Prof_Init
+ *
+ * \section Description
+ * Function to start the cycle counter and clear all probes.
+ * \section Req_ID
+ * Prof_0x01
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * :Start the DWT cycle counter (Systick_EnableCycleCounter);
+ * :Clear all probes;
+ *
+ * end
+ * @enduml
+*/
+void Prof_Init(void)
+{
+#ifndef PROF_HOST_SIMULATION
+    /* the cycle counter is shared with the SysTick delays and timestamps */
+    Systick_EnableCycleCounter();
+#endif
+    Prof_Reset();
+}
+
+/**
+ * \section Service_Name
+ * Prof_GetCounter
+ *
+ * \section Description
+ * Function to read the free running counter used by the probes.
+ * \section Req_ID
+ * Prof_0x02
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return Prof_CounterType
+ *
+ * @startuml
+ * start
+ * if (Target build) then (yes)
+ * :Return DWT CYCCNT;
+ * elseif (x86 host build) then (yes)
+ * :Return the time stamp counter;
+ * else (no)
+ * :Return monotonic clock in ns;
+ * endif
+ * end
+ * @enduml
+*/
+Prof_CounterType Prof_GetCounter(void)
+{
+#ifndef PROF_HOST_SIMULATION
+    return DWT->CYCCNT;
+#elif defined(__x86_64__) || defined(__i386__)
+    /* truncated to 32 bits like CYCCNT */
+    return (Prof_CounterType)__rdtsc();
+#else
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    /* truncated to 32 bits, differences stay valid across the wrap like CYCCNT */
+    return (Prof_CounterType)((uint64)Now.tv_sec * 1000000000ULL + (uint64)Now.tv_nsec);
+#endif
+}
+
+/**
+ * \section Service_Name
+ * Prof_Record
+ *
+ * \section Description
+ * Function to accumulate one measurement into a probe.
+ * \section Req_ID
+ * Prof_0x03
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant for the same probe
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] ProbeId
+ * \param[in] Elapsed
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ * if (ProbeId is valid) then (yes)
+ * :Update min / max;
+ * :Add to total and count;
+ * else (no)
+ * :Report Error;
+ * endif
+ * end
+ * @enduml
+*/
+void Prof_Record(Prof_ProbeIdType ProbeId, Prof_CounterType Elapsed)
+{
+#if (PROF_DEV_ERROR_DETECT == STD_ON)
+    if (ProbeId >= PROF_NUM_OF_PROBES)
+    {
+        Det_ReportError(PROF_MODULE_ID, PROF_INSTANCE_ID, PROF_RECORD_SID, PROF_E_PARAM_PROBE);
+        return;
+    }
+#endif
+    Prof_StatsType* Probe = &Prof_Probes[ProbeId];
+
+    if ((Probe->Count == 0) || (Elapsed < Probe->Min))
+    {
+        Probe->Min = Elapsed;
+    }
+    if (Elapsed > Probe->Max)
+    {
+        Probe->Max = Elapsed;
+    }
+    Probe->Total += Elapsed;
+    Probe->Count++;
+}
+
+/**
+ * \section Service_Name
+ * Prof_GetStats
+ *
+ * \section Description
+ * Function to copy the accumulated measurements of a probe.
+ * \section Req_ID
+ * Prof_0x04
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] ProbeId
+ * \param[inout] None
+ * \param[out] StatsPtr
+ * \return void
+ *
+ * @startuml
+ * start
+ * if (ProbeId and StatsPtr are valid) then (yes)
+ * :Copy the probe;
+ * else (no)
+ * :Report Error;
+ * endif
+ * end
+ * @enduml
+*/
+void Prof_GetStats(Prof_ProbeIdType ProbeId, Prof_StatsType* StatsPtr)
+{
+#if (PROF_DEV_ERROR_DETECT == STD_ON)
+    if (StatsPtr == NULL_PTR)
+    {
+        Det_ReportError(PROF_MODULE_ID, PROF_INSTANCE_ID, PROF_GET_STATS_SID, PROF_E_PARAM_POINTER);
+        return;
+    }
+    if (ProbeId >= PROF_NUM_OF_PROBES)
+    {
+        Det_ReportError(PROF_MODULE_ID, PROF_INSTANCE_ID, PROF_GET_STATS_SID, PROF_E_PARAM_PROBE);
+        return;
+    }
+#endif
+    *StatsPtr = Prof_Probes[ProbeId];
+}
+
+/**
+ * \section Service_Name
+ * Prof_Reset
+ *
+ * \section Description
+ * Function to clear the measurements of all probes.
+ * \section Req_ID
+ * Prof_0x05
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+*/
+void Prof_Reset(void)
+{
+    uint8 i;
+    for (i = 0; i < PROF_NUM_OF_PROBES; i++)
+    {
+        Prof_Probes[i].Count = 0;
+        Prof_Probes[i].Min = 0;
+        Prof_Probes[i].Max = 0;
+        Prof_Probes[i].Total = 0;
+    }
+}
+
+/**
+ * \section Service_Name
+ * Prof_Dump
+ *
+ * \section Description
+ * Function to print every used probe over a UART, one line per probe:
+ * "P<id> n=<count> min=<min> max=<max> mean=<mean>"
+ * \section Req_ID
+ * Prof_0x06
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] UART_ID
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ * repeat
+ * if (Probe was recorded) then (yes)
+ * :Format count, min, max and mean;
+ * :Transmit the line;
+ * endif
+ * repeat while (Probes left?) is (Yes) not (no)
+ * end
+ * @enduml
+*/
+void Prof_Dump(USART_ID UART_ID)
+{
+    uint8 Line[96];
+    uint8 Length;
+    uint8 i;
+
+    for (i = 0; i < PROF_NUM_OF_PROBES; i++)
+    {
+        /* skip the probes that never ran */
+        if (Prof_Probes[i].Count == 0)
+        {
+            continue;
+        }
+        Length = Prof_AppendField(Line, 0, "P", i);
+        Length = Prof_AppendField(Line, Length, " n=", Prof_Probes[i].Count);
+        Length = Prof_AppendField(Line, Length, " min=", Prof_Probes[i].Min);
+        Length = Prof_AppendField(Line, Length, " max=", Prof_Probes[i].Max);
+        Length = Prof_AppendField(Line, Length, " mean=", Prof_Probes[i].Total / Prof_Probes[i].Count);
+        Line[Length++] = '\r';
+        Line[Length++] = '\n';
+        USART_TransmitString(UART_ID, Line, Length, PROF_DUMP_TIMEOUT);
+    }
+}
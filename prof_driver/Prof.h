@@ -0,0 +1,208 @@
+/*
+ * @file Prof.h
+ * @brief Header file for the Profiling module.
+ *
+ * This file contains the declarations and definitions for the Profiling module that measures
+ * the execution time of code sections on the DWT cycle counter.
+ *
+ * @copyright [Cairo Racing team -Formula students]
+ * @author [ Mohamed Mabrouk, Ahmed Yassin , Farah Ahmed]
+ * @date [17 0ct 2023]
+ *
+ * @SWversion 1.0.0
+ *
+ * @remarks
+ *    -Project          : AUTOSAR  R22-11 MCAL
+ *    -Platform         : ARM
+ *    -Peripherial      : STM32F103C8T6
+ *    -AUTOSAR Version  : NOT AVAILBLE
+ */
+ /*==================================================================================================================================*/
+
+#ifndef PROF_H
+#define PROF_H
+
+/****************************************************************************
+*****************************  Includes   ***********************************
+*****************************************************************************/
+
+#include "Std_Types.h"
+#include "Prof_Cfg.h"
+#include "Uart.h"
+
+/**
+ * @brief Defination of PROF Module Id
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 250U
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+#define PROF_MODULE_ID    				(250U)
+
+/**
+ * @brief Defination of PROF Instance ID
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0U
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+#define PROF_INSTANCE_ID    			(0U)
+
+/**
+ * @brief Defination of Module Version 1
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 1U
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+#define PROF_SW_VERSION      	     	(1U)
+
+/**
+ * @brief Software Version checking between Prof_Cfg.h and Prof.h files
+ */
+#if (PROF_CFG_SW_VERSION != PROF_SW_VERSION)
+#error "The SW version of Prof_Cfg.h does not match the expected version"
+#endif
+
+/* ===================================================================================================
+												 Development Errors Id
+	 ===================================================================================================*/
+
+/**
+ * @brief Defination of passing parameters to be used in Det_ReportError as Wrong probe in code
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x14
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+#define PROF_E_PARAM_PROBE					 0x14      /* API parameter checking: invalid probe id */
+/**
+ * @brief Defination of passing parameters to be used in Det_ReportError as Wrong Null pointer in code
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x16
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+#define PROF_E_PARAM_POINTER				 0x16      /* API parameter checking: invalid pointer */
+
+ /* ===================================================================================================
+							     		 API Service Id Macros
+    ===================================================================================================*/
+#define PROF_INIT_SID                       (uint8)0x01
+#define PROF_RECORD_SID                     (uint8)0x02
+#define PROF_GET_STATS_SID                  (uint8)0x03
+
+/* ===================================================================================================
+											Module Data Types
+   ===================================================================================================*/
+typedef uint8  Prof_ProbeIdType;    /* Index of a probe, Range 0 .. PROF_NUM_OF_PROBES-1 */
+typedef uint32 Prof_CounterType;    /* Unit PROF_COUNTER_UNIT */
+
+/* Unit of Prof_CounterType: core cycles on target, time stamp counter cycles on an x86 host
+ * build (PROF_HOST_SIMULATION), nanoseconds on any other host */
+#if !defined(PROF_HOST_SIMULATION) || defined(__x86_64__) || defined(__i386__)
+#define PROF_COUNTER_UNIT                   "cycles"
+#else
+#define PROF_COUNTER_UNIT                   "ns"
+#endif
+
+/* Structure holding the accumulated measurements of one probe */
+typedef struct
+{
+	uint32 Count;                   /* Number of recorded measurements */
+	Prof_CounterType Min;           /* Shortest measurement */
+	Prof_CounterType Max;           /* Longest measurement */
+	uint64 Total;                   /* Sum of all measurements, used for the mean */
+} Prof_StatsType;
+
+/* ===================================================================================================
+										   Probe Macros
+   ===================================================================================================*/
+/* A driver sets PROF_MODULE_PROFILING to its own profiling switch before including this file,
+ * its probes expand to nothing when the switch is STD_OFF */
+#ifndef PROF_MODULE_PROFILING
+#define PROF_MODULE_PROFILING	(STD_ON)
+#endif
+
+#if ((PROF_ENABLED == STD_ON) && (PROF_MODULE_PROFILING == STD_ON))
+/* Open a measurement scope for probe ID, must be closed by PROF_STOP in the same block */
+#define PROF_START(ID)		Prof_CounterType Prof_Start_##ID = Prof_GetCounter()
+/* Close the measurement scope opened by PROF_START and accumulate it */
+#define PROF_STOP(ID)		Prof_Record((ID), Prof_GetCounter() - Prof_Start_##ID)
+#else
+#define PROF_START(ID)
+#define PROF_STOP(ID)
+#endif
+
+/* ===================================================================================================
+										   Function Prototypes
+   ===================================================================================================*/
+
+/**
+ * @brief Start the cycle counter and clear all probes.
+ *
+ * @param[in]   None
+ * @param[out]  None
+ * @return      None
+ */
+void Prof_Init(void);
+
+/**
+ * @brief Read the free running counter used by the probes.
+ *
+ * @param[in]   None
+ * @return      Counter value in PROF_COUNTER_UNIT.
+ */
+Prof_CounterType Prof_GetCounter(void);
+
+/**
+ * @brief Accumulate one measurement into a probe.
+ *
+ * @param[in] ProbeId - The probe to update.
+ * @param[in] Elapsed - The measured duration.
+ * @return      None
+ */
+void Prof_Record(Prof_ProbeIdType ProbeId, Prof_CounterType Elapsed);
+
+/**
+ * @brief Copy the accumulated measurements of a probe.
+ *
+ * @param[in]  ProbeId  - The probe to read.
+ * @param[out] StatsPtr - Pointer to store the measurements.
+ * @return     None
+ */
+void Prof_GetStats(Prof_ProbeIdType ProbeId, Prof_StatsType* StatsPtr);
+
+/**
+ * @brief Clear the measurements of all probes.
+ *
+ * @param[in]   None
+ * @param[out]  None
+ * @return      None
+ */
+void Prof_Reset(void);
+
+/**
+ * @brief Print count/min/max/mean of every used probe over a UART.
+ *
+ * @param[in] UART_ID - The UART to print on.
+ * @return      None
+ */
+void Prof_Dump(USART_ID UART_ID);
+
+#endif
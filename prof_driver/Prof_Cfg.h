@@ -0,0 +1,58 @@
+/*
+ * @file Prof_Cfg.h
+ * @brief Configrution Header file for the Profiling module.
+ *
+ *
+ * @copyright [Cairo Racing team -Formula students]
+ * @author [ Mohamed Mabrouk, Ahmed Yassin , Farah Ahmed]
+ * @date [17 0ct 2023]
+ *
+ * @SWversion 1.0.0
+ *
+ * @remarks
+ *    -Project          : AUTOSAR  R22-11 MCAL
+ *    -Platform         : ARM
+ *    -Peripherial      : STM32F103C8T6
+ *    -AUTOSAR Version  : NOT AVAILBLE
+ */
+ /*==================================================================================================================================*/
+
+#ifndef PROF_CFG_H_
+#define PROF_CFG_H_
+
+/*============================================================================*/
+
+/*
+ * Module Version 1.0.0
+ */
+#define PROF_SW_MAJOR_VERSION                   (1U)
+#define PROF_SW_MINOR_VERSION                   (0U)
+#define PROF_SW_PATCH_VERSION                   (0U)
+
+#define PROF_CFG_SW_VERSION                     (1U)
+
+
+/* Pre-compile option to build the probes, PROF_START/PROF_STOP expand to nothing when STD_OFF */
+#define PROF_ENABLED                            (STD_ON)
+
+/* Pre-compile option for Development Error Detect */
+#define PROF_DEV_ERROR_DETECT                   (STD_ON)
+
+/* Number of probes accumulated by the module */
+#define PROF_NUM_OF_PROBES                      (7U)
+
+/* Timeout passed to USART_TransmitString by Prof_Dump */
+#define PROF_DUMP_TIMEOUT                       (5U)
+
+/*******************************************************************************/
+
+/* Configured probes */
+#define PROF_PROBE_PORT_INIT                    (0U)
+#define PROF_PROBE_UART_TRANSMIT                (1U)
+#define PROF_PROBE_DIO_WRITE                    (2U)
+#define PROF_PROBE_SYSTICK_CALLBACK             (3U)
+#define PROF_PROBE_SOFT_PWM_TICK                (4U)
+#define PROF_PROBE_SOFT_PWM_SET_DUTY            (5U)
+#define PROF_PROBE_PORT_LOOKUP                  (6U)
+
+#endif /* PROF_CFG_H_ */
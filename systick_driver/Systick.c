@@ -24,6 +24,15 @@
 #include "Systick.h"
 #include "Det.h"
 
+#ifdef SYSTICK_HOST_SIMULATION
+/* Host build: the critical sections save and set the simulated PRIMASK, and the interrupt
+ * points where interrupts are unmasked call Systick_SimulatedInterrupt */
+#undef ENTER_CRITICAL_SECTION
+#undef EXIT_CRITICAL_SECTION
+#define ENTER_CRITICAL_SECTION(STATE)   ((STATE) = Systick_SimulatedMask())
+#define EXIT_CRITICAL_SECTION(STATE)    Systick_SimulatedUnmask(STATE)
+#endif
+
 /*==================================================================================================================================*/
 
 /****************************************************************************
@@ -32,7 +41,243 @@
 
 /* Systick_Configs store the default values of port that you declare it in Lcfg.c  */
 static Systick_ConfigType Systick_Configs;
-uint8 SingleIntervalFlag = 0 ;
+
+/* Notification of the running timer and the context passed back to it */
+static Systick_NotificationType SysTickCallback = NULL_PTR;
+static void* SysTickContext = NULL_PTR;
+
+/* State of the interrupt driven timer, shared with SysTick_Handler and only changed with interrupts masked */
+static volatile Systick_StateType Systick_State = SYSTICK_STATE_IDLE;
+
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+/* Interrupt timing recorded by SysTick_Handler */
+static Systick_JitterStatsType Systick_JitterStats;
+/* Incremented by Systick_Halt: a callback that stops or restarts the timer changes it */
+static volatile uint32 Systick_Halts;
+#endif
+
+ /*==================================================================================================================================*/
+/****************************************************************************
+*****************************  Local Functions   ****************************
+*****************************************************************************/
+
+#ifdef SYSTICK_HOST_SIMULATION
+/* An interrupt can be taken here unless PRIMASK masks it */
+static void Systick_SimulatedInterruptPoint(void)
+{
+    if ((Systick_SimulatedPrimask == 0U) && (Systick_SimulatedInterrupt != NULL_PTR))
+    {
+        Systick_SimulatedInterrupt();
+    }
+}
+
+/* ENTER_CRITICAL_SECTION of the host build: returns the previous PRIMASK */
+static uint32 Systick_SimulatedMask(void)
+{
+    uint32 State = Systick_SimulatedPrimask;
+
+    Systick_SimulatedInterruptPoint();
+    Systick_SimulatedPrimask = 1U;
+    return State;
+}
+
+/* EXIT_CRITICAL_SECTION of the host build: restores PRIMASK */
+static void Systick_SimulatedUnmask(uint32 State)
+{
+    Systick_SimulatedPrimask = State;
+    Systick_SimulatedInterruptPoint();
+}
+#endif
+
+/* Ticks counted down by VAL from Previous to Current, handling one reload in between */
+LOCAL_INLINE uint32 Systick_TicksBetween(uint32 Previous, uint32 Current, uint32 Reload)
+{
+    if (Current <= Previous)
+    {
+        return (Previous - Current);
+    }
+    /* the counter reached zero and was reloaded in between */
+    return (Previous + (Reload + 1 - Current));
+}
+
+/* Stop the counter and its interrupt and drop an already pending one, called with interrupts masked */
+static void Systick_Halt(void)
+{
+    SYSTICK->CTRL &= ~((1UL << SYSTICK_CTRL_ENABLE) | (1UL << SYSTICK_CTRL_TICKINT));
+    SCB_ICSR = SCB_ICSR_PENDSTCLR;
+    Systick_State = SYSTICK_STATE_IDLE;
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+    Systick_Halts++;
+#endif
+}
+
+/**
+ * \section Service_Name
+ * Systick_EnableCycleCounter
+ *
+ * \section Description
+ * Function to start the DWT cycle counter once, it keeps running afterwards.
+ * Shared with the profiling module so that the trace unit is enabled in one place.
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (CYCCNTENA is clear) then (yes)
+ *  :Enable the trace unit;
+ *  :Enable the DWT cycle counter;
+ * endif
+ *
+ * end
+ * @enduml
+*/
+void Systick_EnableCycleCounter(void)
+{
+    if (!GET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA))
+    {
+        SET_BIT(COREDEBUG_DEMCR, COREDEBUG_DEMCR_TRCENA);
+        SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA);
+    }
+}
+
+#if (SYSTICK_DELAY_API == STD_ON)
+#if (SYSTICK_DELAY_USE_CYCLE_COUNTER == STD_ON)
+/* Busy-wait on the DWT cycle counter, the SysTick registers are only read */
+static void Systick_WaitCycles(uint32 Cycles)
+{
+    uint32 Start;
+
+    Systick_EnableCycleCounter();
+
+    Start = DWT->CYCCNT;
+    /* unsigned subtraction keeps working across the 32-bit wrap of CYCCNT */
+    while ((DWT->CYCCNT - Start) < Cycles);
+}
+#else
+/* Let the counter free run over its full 24-bit range if no timer keeps it running,
+ * returns STD_HIGH if the counter was started here */
+static uint8 Systick_StartFreeRunning(void)
+{
+    uint32 InterruptState;
+    uint8 Started = STD_LOW;
+
+    ENTER_CRITICAL_SECTION(InterruptState);
+    if (!GET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE))
+    {
+        SYSTICK->LOAD = 0x00FFFFFF;
+        SYSTICK->VAL = 0;
+        SET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);
+        Started = STD_HIGH;
+    }
+    EXIT_CRITICAL_SECTION(InterruptState);
+
+    return Started;
+}
+
+/* Busy-wait on the free running VAL register, the running timer is left untouched */
+static void Systick_WaitCycles(uint32 Cycles)
+{
+    uint32 Ticks = Cycles;
+    uint32 Elapsed = 0;
+    uint32 Reload;
+    uint32 Previous;
+    uint32 Current;
+    uint32 InterruptState;
+    uint8 StartedHere;
+
+    /* The counter runs at AHB/8 when CLKSOURCE is cleared */
+    if (!GET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_CLKSOURCE))
+    {
+        Ticks = Cycles >> 3;
+    }
+
+    StartedHere = Systick_StartFreeRunning();
+
+    Reload = SYSTICK->LOAD;
+    Previous = SYSTICK->VAL;
+    while (Elapsed < Ticks)
+    {
+        Current = SYSTICK->VAL;
+
+        if (!GET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE))
+        {
+            /* a one-shot timer expired or a timer was stopped from an interrupt, VAL is frozen:
+             * restart the counter and measure again from its new value */
+            StartedHere |= Systick_StartFreeRunning();
+            Reload = SYSTICK->LOAD;
+            Previous = SYSTICK->VAL;
+        }
+        else if (SYSTICK->LOAD != Reload)
+        {
+            /* a timer was restarted from an interrupt, the ticks since the last read are
+             * dropped as the wrap can not be computed across the reload change */
+            Reload = SYSTICK->LOAD;
+            Previous = SYSTICK->VAL;
+        }
+        else
+        {
+            Elapsed += Systick_TicksBetween(Previous, Current, Reload);
+            Previous = Current;
+        }
+    }
+
+    /* a timer started meanwhile owns the counter now */
+    ENTER_CRITICAL_SECTION(InterruptState);
+    if ((StartedHere == STD_HIGH) && (Systick_State == SYSTICK_STATE_IDLE))
+    {
+        CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);
+    }
+    EXIT_CRITICAL_SECTION(InterruptState);
+}
+#endif
+#endif
+
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+/* Record the handler entry latency and the callback duration of one interrupt. Reload is the
+ * period sampled at entry, the callback may have restarted the timer with another one; the
+ * duration is only recorded when the counter kept running (DurationValid) */
+static void Systick_RecordJitter(uint32 EntryValue, uint32 Reload, uint32 ExitValue, boolean DurationValid)
+{
+    Systick_ValueType Latency = Reload - EntryValue;
+    Systick_ValueType Duration;
+    uint32 Bin = Latency / SYSTICK_JITTER_BIN_WIDTH;
+
+    if (Bin >= SYSTICK_JITTER_HIST_BINS)
+    {
+        Bin = SYSTICK_JITTER_HIST_BINS - 1;
+    }
+    Systick_JitterStats.LatencyHistogram[Bin]++;
+
+    Systick_JitterStats.LastLatency = Latency;
+    if (Latency > Systick_JitterStats.MaxLatency)
+    {
+        Systick_JitterStats.MaxLatency = Latency;
+    }
+    if (DurationValid == TRUE)
+    {
+        Duration = Systick_TicksBetween(EntryValue, ExitValue, Reload);
+        Systick_JitterStats.LastCallbackDuration = Duration;
+        if (Duration > Systick_JitterStats.MaxCallbackDuration)
+        {
+            Systick_JitterStats.MaxCallbackDuration = Duration;
+        }
+    }
+    Systick_JitterStats.Count++;
+}
+#endif
 
  /*==================================================================================================================================*/
 /****************************************************************************
@@ -92,6 +337,7 @@ void Systick_Init(const Systick_ConfigType* ConfigPtr)
         /* set the configuration of the Lcfg.c into the global variable */
         Systick_Configs.SysTick_ChannelMode = ConfigPtr->SysTick_ChannelMode;
         Systick_Configs.Copy_ptr = ConfigPtr->Copy_ptr;
+        Systick_Configs.Context = ConfigPtr->Context;
     }
     else
     {
@@ -214,7 +460,7 @@ Systick_ValueType Systick_GetTimeRemaining(void)
  * Systick_StartTimer
  *
  * \section Description
- * Function to Starts Systick timer.
+ * Function to Starts Systick timer with the notification of the configuration.
  * \section Req_ID
  * Systick_0x05
  *
@@ -234,33 +480,90 @@ Systick_ValueType Systick_GetTimeRemaining(void)
  *
  * @startuml
  * start
- * 
+ *
+ * :Start the timer with Copy_ptr and Context of the configuration;
+ *
+ * end
+ * @enduml
+*/
+void Systick_StartTimer(Systick_ValueType Value)
+{
+    Systick_StartTimerWithCallback(Value, Systick_Configs.Copy_ptr, Systick_Configs.Context);
+}
+/**
+ * \section Service_Name
+ * Systick_StartTimerWithCallback
+ *
+ * \section Description
+ * Function to Starts Systick timer and register the notification called on its expiry.
+ * \section Req_ID
+ * Systick_0x0F
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] Value
+ * \param[in] Callback \ Notification called from SysTick_Handler
+ * \param[in] Context  \ Pointer passed back to Callback, may be NULL_PTR
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (Interrupt mode and Callback is NULL) then (yes)
+ * :Report Error;
+ * stop
+ * endif
+ * :Mask interrupts;
+ * :Stop the running timer and drop its pending interrupt;
  * :CLEAR THE VAL REGISTER;
  * :PUT THE TIME NEEDED IN LOAD REGISTER;
  *
  * switch (Timer Mode?)
  * case ( )
+ * :Restore interrupts;
  * :Enable the Counter;
  * while (Count_flag=0)
  * :Stay Still Till Counter Finish;
  * endwhile
  * :Disable the Counter;
- * case ( ) 
- * :Save the callbackFunc Address;
- * :Set The SingleIntervalFlag;
- * :Enable TICK INTERRUPT;
- * :Enable the Counter;
  * case ( )
- * :Save the callbackFunc Address;
- * :Enable TICK INTERRUPT;
- * :Enable the Counter;
+ * :Save the callbackFunc Address and Context;
+ * :State = SINGLE_RUNNING;
+ * :Enable TICK INTERRUPT and the Counter;
+ * :Restore interrupts;
+ * case ( )
+ * :Save the callbackFunc Address and Context;
+ * :State = PERIODIC_RUNNING;
+ * :Enable TICK INTERRUPT and the Counter;
+ * :Restore interrupts;
  * endswitch
- * 
+ *
  * end
  * @enduml
 */
-void Systick_StartTimer(Systick_ValueType Value)
+void Systick_StartTimerWithCallback(Systick_ValueType Value, Systick_NotificationType Callback, void* Context)
 {
+    uint32 InterruptState;
+
+    if ((Callback == NULL_PTR) && (Systick_Configs.SysTick_ChannelMode != SYSTICK_BUSYWAIT))
+    {
+    	/* report error: no notification for an interrupt driven timer */
+        Det_ReportError(SYSTICK_MODULE_ID, SYSTICK_INSTANCE_ID, SYSTICK_START_TIMER_CALLBACK_SID, SYSTICK_E_PARAM_POINTER);
+        return;
+    }
+
+    /* the whole restart is one step for SysTick_Handler: no callback of the old run can follow */
+    ENTER_CRITICAL_SECTION(InterruptState);
+    Systick_Halt();
     /* Clear the current value register */
     SYSTICK->VAL = 0;
     /* Load the number of ticks to wait in microseconds */
@@ -270,38 +573,35 @@ void Systick_StartTimer(Systick_ValueType Value)
         case SYSTICK_BUSYWAIT:
             /* Set the enable bit to begin counting */
             SET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);
+            EXIT_CRITICAL_SECTION(InterruptState);
             /* Wait until the COUNTFLAG becomes 1 (indicating the time has elapsed) */
             while (!GET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_COUNTFLAG));
-            /* Clear the enable bit to stop counting */
-            CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);
+            /* Clear the enable bit to stop counting, unless an interrupt started a new timer */
+            ENTER_CRITICAL_SECTION(InterruptState);
+            if (Systick_State == SYSTICK_STATE_IDLE)
+            {
+                CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);
+            }
             break;
         case SYSTICK_SINGLE_INTERVAL:
-            /* set the callback pointer */
-            SysTickCallback = Systick_Configs.Copy_ptr;
-            /* mark that you entered this function */
-            SingleIntervalFlag = 1;
+            /* set the callback pointer and its context */
+            SysTickCallback = Callback;
+            SysTickContext = Context;
+            /* the next interrupt stops the timer */
+            Systick_State = SYSTICK_STATE_SINGLE_RUNNING;
             /* set the interrupt and enable bits to begin counting */
-            SET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_TICKINT);
-            SET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);
+            SYSTICK->CTRL |= (1UL << SYSTICK_CTRL_TICKINT) | (1UL << SYSTICK_CTRL_ENABLE);
             break;
         case SYSTICK_PERIODIC_INTERVAL:
-            /* Set the callback pointer */
-            SysTickCallback = Systick_Configs.Copy_ptr;
+            /* Set the callback pointer and its context */
+            SysTickCallback = Callback;
+            SysTickContext = Context;
+            Systick_State = SYSTICK_STATE_PERIODIC_RUNNING;
             /* Set the interrupt and enable bits to begin counting */
-            SET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_TICKINT);
-            SET_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);
+            SYSTICK->CTRL |= (1UL << SYSTICK_CTRL_TICKINT) | (1UL << SYSTICK_CTRL_ENABLE);
             break;
     }
-    
-    if (*SysTickCallback == NULL_PTR)
-    {
-    	/* report error: SysTickCallback is NULL */
-        Det_ReportError(SYSTICK_MODULE_ID, SYSTICK_INSTANCE_ID, SYSTICK_START_TIMER_SID, SYSTICK_E_PARAM_POINTER);
-    }
-    else
-    {
-        // Do Nothing
-    }
+    EXIT_CRITICAL_SECTION(InterruptState);
 }
 
 /**
@@ -330,17 +630,25 @@ void Systick_StartTimer(Systick_ValueType Value)
  * @startuml
  * start
  * 
- * :Disable The Counter;
+ * :Mask interrupts;
+ * :Disable The Counter and TICK INTERRUPT;
+ * :Drop a pending interrupt;
+ * :State = IDLE;
  * :CLEAR THE VAL REGISTER;
+ * :Restore interrupts;
  * 
  * end
  * @enduml
 */
 void Systick_StopTimer(void)
 {
-	/*Clear the value of Enable bit*/
-	CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);
+	uint32 InterruptState;
+
+	/*Stop the counter, no callback is delivered once this returns*/
+	ENTER_CRITICAL_SECTION(InterruptState);
+	Systick_Halt();
 	SYSTICK->VAL = 0;
+	EXIT_CRITICAL_SECTION(InterruptState);
 }
 /**
  * \section Service_Name
@@ -368,22 +676,183 @@ void Systick_StopTimer(void)
  * @startuml
  * start
  *
+ * :Mask interrupts;
  * switch (Timer Mode?)
  * case ( )
  * :Set the Mode to BUSYWAIT;
+ * :Stop a running interrupt timer;
  * case ( ) 
  * :Set the Mode to SINGLE_INTERVAL;
+ * :A running timer stops after its next interrupt;
  * case ( )
  * :Set the Mode to PERIODIC_INTERVAL;
+ * :A running timer keeps running;
  * endswitch
+ * :Restore interrupts;
  *
  * end
  * @enduml
 */
 void Systick_SetMode(Systick_ModeType Mode)
 {
-	/*Setting given mode into the LCfg.c */
+	uint32 InterruptState;
+
+	if (Mode > SYSTICK_PERIODIC_INTERVAL)
+	{
+		Det_ReportError(SYSTICK_MODULE_ID, SYSTICK_INSTANCE_ID, SYSTICK_SET_MODE_SID, SYSTICK_E_PARAM_MODE);
+		return;
+	}
+
+	/*Setting given mode, a running timer switches at its next interrupt*/
+	ENTER_CRITICAL_SECTION(InterruptState);
 	Systick_Configs.SysTick_ChannelMode = Mode;
+	if (Systick_State != SYSTICK_STATE_IDLE)
+	{
+		switch (Mode)
+		{
+			case SYSTICK_BUSYWAIT:
+				/* busy-wait has no interrupt, the running timer is stopped */
+				Systick_Halt();
+				break;
+			case SYSTICK_SINGLE_INTERVAL:
+				Systick_State = SYSTICK_STATE_SINGLE_RUNNING;
+				break;
+			case SYSTICK_PERIODIC_INTERVAL:
+				Systick_State = SYSTICK_STATE_PERIODIC_RUNNING;
+				break;
+		}
+	}
+	EXIT_CRITICAL_SECTION(InterruptState);
+}
+#if (SYSTICK_DELAY_API == STD_ON)
+/**
+ * \section Service_Name
+ * Systick_DelayCycles
+ *
+ * \section Description
+ * Function to busy-wait a number of core cycles without disturbing the running timer.
+ * \section Req_ID
+ * Systick_0x0D
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] Cycles
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * :Take the start value of the counter;
+ * while (Elapsed < Cycles)
+ * if (Counter stopped or reloaded meanwhile) then (yes)
+ * :Restart the counter if needed and take a new start value;
+ * else (no)
+ * :Read the counter and add the difference (handling the wrap);
+ * endif
+ * endwhile
+ *
+ * end
+ * @enduml
+*/
+void Systick_DelayCycles(uint32 Cycles)
+{
+	Systick_WaitCycles(Cycles);
+}
+/**
+ * \section Service_Name
+ * Systick_DelayUs
+ *
+ * \section Description
+ * Function to busy-wait a number of microseconds without disturbing the running timer.
+ * \section Req_ID
+ * Systick_0x0D
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] Us
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+ *
+ * @startuml
+ * start
+ *
+ * if (Us does not fit in 32-bit cycles) then (yes)
+ * :Report Error;
+ * else (no)
+ * :Convert microseconds to core cycles;
+ * :Wait the cycles;
+ * endif
+ *
+ * end
+ * @enduml
+*/
+void Systick_DelayUs(uint32 Us)
+{
+	if (Us > (0xFFFFFFFFUL / (SYSTICK_CORE_CLOCK_HZ / 1000000UL)))
+	{
+		/* the delay does not fit in 32-bit core cycles */
+		Det_ReportError(SYSTICK_MODULE_ID, SYSTICK_INSTANCE_ID, SYSTICK_DELAY_SID, SYSTICK_E_PARAM_VALUE);
+		return;
+	}
+
+	/* convert the time into core cycles */
+	Systick_WaitCycles(Us * (SYSTICK_CORE_CLOCK_HZ / 1000000UL));
+}
+#endif
+/**
+ * \section Service_Name
+ * Systick_GetTimestamp
+ *
+ * \section Description
+ * Function to get a free running timestamp in core cycles, usable from interrupts
+ * and independent of the timer started with Systick_StartTimer.
+ * \section Req_ID
+ * Systick_0x10
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return uint32 \ core cycles, wraps every 2^32 cycles
+ *
+ * @startuml
+ * start
+ *
+ * :Start the cycle counter if it is stopped;
+ * :return CYCCNT;
+ *
+ * end
+ * @enduml
+*/
+uint32 Systick_GetTimestamp(void)
+{
+    Systick_EnableCycleCounter();
+    return DWT->CYCCNT;
 }
 /**
  * \section Service_Name
@@ -411,44 +880,182 @@ void Systick_SetMode(Systick_ModeType Mode)
  * @startuml
  * start
  *
- * if (SingleIntervalFlag) then (yes)
+ * :Mask interrupts;
+ * :Read the timer state;
+ * if (State == SINGLE_RUNNING) then (yes)
  * :Clear Tick Interrupt;
+ * :State = IDLE;
+ * endif
+ * :Restore interrupts;
+ * if (State != IDLE) then (yes)
+ * :Jump to given function to be excuted when ISR flag is fired;
+ * endif
+ * if (One-shot and not restarted by the callback) then (yes)
  * :Disable Counter;
- * :SingleIntervalFlag=0;
  * endif
  * :Clear CountFlag;
- * :Jump to given function to be excuted when ISR flag is fired;
  *
  * end
  * @enduml
 */
 void SysTick_Handler()
 {
-    /* call the callback function (if set) to handle the SysTick interrupt */
-    if (SysTickCallback != NULL_PTR)
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+    /* sample the counter first so the latency does not include the handler body, and the
+     * period before the callback can restart the timer */
+    uint32 EntryValue = SYSTICK->VAL;
+    uint32 EntryReload = SYSTICK->LOAD;
+    uint32 EntryHalts = Systick_Halts;
+#endif
+    uint32 InterruptState;
+    Systick_StateType State;
+    Systick_NotificationType Callback;
+    void* Context;
+
+    /* take the state and its notification and retire a one-shot timer in one step,
+     * a higher priority interrupt calling the Systick APIs can not interleave with it */
+    ENTER_CRITICAL_SECTION(InterruptState);
+    State = Systick_State;
+    Callback = SysTickCallback;
+    Context = SysTickContext;
+    if (State == SYSTICK_STATE_SINGLE_RUNNING)
     {
-        SysTickCallback();  /* Call the callback function */
+        /* no further interrupt, the counter keeps running until the callback returns */
+        CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_TICKINT);
+        Systick_State = SYSTICK_STATE_IDLE;
     }
-    else
+    EXIT_CRITICAL_SECTION(InterruptState);
+
+    /* an interrupt of a timer stopped meanwhile is not delivered */
+    if (State != SYSTICK_STATE_IDLE)
     {
-    	/* report error: SysTickCallback is NULL */
-        Det_ReportError(SYSTICK_MODULE_ID, SYSTICK_INSTANCE_ID, SYSTICK_START_TIMER_SID, SYSTICK_E_PARAM_POINTER);
-       
+        /* call the callback function (if set) to handle the SysTick interrupt */
+        if (Callback != NULL_PTR)
+        {
+            Callback(Context);  /* Call the callback function with its context */
+        }
+        else
+        {
+            /* report error: SysTickCallback is NULL */
+            Det_ReportError(SYSTICK_MODULE_ID, SYSTICK_INSTANCE_ID, SYSTICK_START_TIMER_SID, SYSTICK_E_PARAM_POINTER);
+        }
+
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+        Systick_RecordJitter(EntryValue, EntryReload, SYSTICK->VAL,
+                             (Systick_Halts == EntryHalts) ? TRUE : FALSE);
+#endif
     }
 
-    /* Stop continuous counting in single interval mode */
-    if (SingleIntervalFlag == SYSTICK_ONE_SHOT)
+    /* Stop the counter of a one-shot timer unless the callback started a new one */
+    if (State == SYSTICK_STATE_SINGLE_RUNNING)
     {
-        CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_TICKINT); /* disable SysTick interrupt */
-        CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);  /* disable SysTick timer */
-        SingleIntervalFlag = 0;  /* reset the mark flag */
+        ENTER_CRITICAL_SECTION(InterruptState);
+        if (Systick_State == SYSTICK_STATE_IDLE)
+        {
+            CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_ENABLE);  /* disable SysTick timer */
+        }
+        EXIT_CRITICAL_SECTION(InterruptState);
     }
 
-    /* clear the countflag */
-    CLEAR_BIT(SYSTICK->CTRL, SYSTICK_CTRL_COUNTFLAG); 
+    /* reading CTRL clears the countflag, a write back could undo a timer started or stopped meanwhile */
+    (void) SYSTICK->CTRL;
 }
 
 
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+/**
+ * \section Service_Name
+ * Systick_GetJitterStats
+ *
+ * \section Description
+ * Function to copy the interrupt latency and callback duration recorded by SysTick_Handler.
+ * The copy is taken with interrupts masked so it is never torn by the handler.
+ * \section Req_ID
+ * Systick_0x0E
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] StatsPtr
+ * \return void
+ *
+ * @startuml
+ * start
+ * if (ptr == null) then (yes)
+ * :Report Error;
+ * else (no)
+ * :Enter critical section;
+ * :Copy the recorded measurements;
+ * :Exit critical section;
+ * endif
+ * end
+ * @enduml
+*/
+void Systick_GetJitterStats(Systick_JitterStatsType* StatsPtr)
+{
+    uint32 InterruptState;
+
+    if (StatsPtr != NULL_PTR)
+    {
+        /* SysTick_Handler updates several fields per interrupt */
+        ENTER_CRITICAL_SECTION(InterruptState);
+        *StatsPtr = Systick_JitterStats;
+        EXIT_CRITICAL_SECTION(InterruptState);
+    }
+    else
+    {
+        Det_ReportError(SYSTICK_MODULE_ID, SYSTICK_INSTANCE_ID, SYSTICK_GET_JITTER_STATS_SID, SYSTICK_E_PARAM_POINTER);
+    }
+}
+/**
+ * \section Service_Name
+ * Systick_ResetJitterStats
+ *
+ * \section Description
+ * Function to clear the interrupt latency and callback duration measurements.
+ * \section Req_ID
+ * Systick_0x0E
+ *
+ * \section Scope
+ * Public
+ *
+ * \section Re-entrancy
+ * Non Reentrant
+ *
+ * \section Sync_Async
+ * Synchronous
+ *
+ * \param[in] None
+ * \param[inout] None
+ * \param[out] None
+ * \return void
+*/
+void Systick_ResetJitterStats(void)
+{
+    uint8 i;
+    uint32 InterruptState;
+
+    ENTER_CRITICAL_SECTION(InterruptState);
+    Systick_JitterStats.Count = 0;
+    Systick_JitterStats.LastLatency = 0;
+    Systick_JitterStats.MaxLatency = 0;
+    Systick_JitterStats.LastCallbackDuration = 0;
+    Systick_JitterStats.MaxCallbackDuration = 0;
+    for (i = 0; i < SYSTICK_JITTER_HIST_BINS; i++)
+    {
+        Systick_JitterStats.LatencyHistogram[i] = 0;
+    }
+    EXIT_CRITICAL_SECTION(InterruptState);
+}
+#endif
 
 /**
  * \section Service_Name
@@ -501,7 +1108,7 @@ void Systick_GetVersionInfo(Std_VersionInfoType* versioninfo)
     /* Copy the Module Id */
 	versioninfo->moduleID  = SYSTICK_MODULE_ID         ;
 	/* Copy Software Version */
-	versioninfo->sw_version = SYSTICK_SW_MAJOR_VERSION ;
+	versioninfo->sw_major_version = SYSTICK_SW_MAJOR_VERSION ;
     }
     else
 	{
@@ -378,6 +378,39 @@
  * - Unit: Bits
  */
 #define SYSTICK_CHECK_WAKEUP_SID            (uint8)0x0C
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x0D
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+#define SYSTICK_DELAY_SID                   (uint8)0x0D
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x0E
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+#define SYSTICK_GET_JITTER_STATS_SID        (uint8)0x0E
+/**
+ * @brief Defination of API to be used in Det_ReportError
+ *
+ *
+ * @details
+ * - Type: define
+ * - Range: 0x0F
+ * - Resolution: Fixed
+ * - Unit: Bits
+ */
+#define SYSTICK_START_TIMER_CALLBACK_SID    (uint8)0x0F
 
 
 #define SYSTICK_MODULE_UNINITIALIZED 			(0U)
@@ -399,6 +432,14 @@ typedef enum
 } Systick_ModeType;
 
 
+typedef enum
+{
+    SYSTICK_STATE_IDLE,                 /* No interrupt driven timer is running */
+    SYSTICK_STATE_SINGLE_RUNNING,       /* One-shot timer armed, stopped by its interrupt */
+    SYSTICK_STATE_PERIODIC_RUNNING      /* Periodic timer running */
+} Systick_StateType;
+
+
 typedef enum
 {
     SYSTICK_PERIODIC,   /* Periodic mode for SysTick */
@@ -418,6 +459,13 @@ typedef enum
 } Systick_Def;                  /* Enum defining bit positions and values for SysTick control register */
 
 
+typedef enum
+{
+    DWT_CTRL_CYCCNTENA = 0,        /* Bit position for the cycle counter enable bit in the DWT control register */
+    COREDEBUG_DEMCR_TRCENA = 24    /* Bit position for the trace enable bit in the DEMCR register */
+} Systick_CycleCounterDef;         /* Enum defining bit positions used to run the DWT cycle counter */
+
+
 typedef enum
 {
     SYSTICK_PREDEF_TIMER_1US_16BIT,    /* Predefined timer type: 16-bit timer with 1us resolution */
@@ -428,26 +476,38 @@ typedef enum
 
 
 
+/* Notification called on the timer expiry, Context is the pointer registered with it */
+typedef void (*Systick_NotificationType)(void* Context);
+
 /* Structure to hold the configuration data for the Port Driver */
 typedef struct
 {
 	Systick_Def Clk;
 	Systick_ModeType SysTick_ChannelMode;
-	void (*Copy_ptr);
+	Systick_NotificationType Copy_ptr;
+	void* Context;
 } Systick_ConfigType;
 
 extern const Systick_ConfigType Systick_Configuration;
+
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+/* Structure holding the interrupt timing recorded by SysTick_Handler, all values in SysTick ticks */
+typedef struct
+{
+	uint32 Count;                                           /* Number of recorded interrupts */
+	Systick_ValueType LastLatency;                          /* Ticks between the reload and the handler entry */
+	Systick_ValueType MaxLatency;                           /* Worst latency seen */
+	Systick_ValueType LastCallbackDuration;                 /* Ticks spent in the callback */
+	Systick_ValueType MaxCallbackDuration;                  /* Worst callback duration seen */
+	uint32 LatencyHistogram[SYSTICK_JITTER_HIST_BINS];      /* Latency distribution, SYSTICK_JITTER_BIN_WIDTH ticks per bin */
+} Systick_JitterStatsType;
+#endif
 /*============================================================================*/
 
 /* ===================================================================================================
 										   Function Prototypes
    ===================================================================================================*/
 
-/**
- * @brief Callback pointer for SysTick.
- */
-void (*SysTickCallback) (void);
-
 /**
  * @brief Initialize the SysTick module.
  *
@@ -491,6 +551,18 @@ Systick_ValueType Systick_GetTimeRemaining(void);
  */
 void Systick_StartTimer(Systick_ValueType Value);
 
+/**
+ * @brief Start the SysTick timer and register the notification called on its expiry.
+ *
+ * @param[in] Value    - The number of ticks to wait.
+ * @param[in] Callback - Notification called from SysTick_Handler.
+ * @param[in] Context  - Pointer passed back to Callback, may be NULL_PTR.
+ * @param[out]  None
+ * @return      None
+ *
+ */
+void Systick_StartTimerWithCallback(Systick_ValueType Value, Systick_NotificationType Callback, void* Context);
+
 /**
  * @brief Stop the SysTick timer.
  *
@@ -509,6 +581,62 @@ void Systick_StopTimer(void);
  */
 void Systick_SetMode(Systick_ModeType Mode);
 
+/**
+ * @brief Busy-wait for a number of core clock cycles without touching the running timer.
+ *
+ * @param[in] Cycles - The number of core cycles to wait.
+ * @param[out]  None
+ * @return      None
+ */
+void Systick_DelayCycles(uint32 Cycles);
+
+/**
+ * @brief Busy-wait for a number of microseconds without touching the running timer.
+ *
+ * @param[in] Us - The number of microseconds to wait.
+ * @param[out]  None
+ * @return      None
+ */
+void Systick_DelayUs(uint32 Us);
+
+/**
+ * @brief Start the DWT cycle counter if it is stopped, it keeps running afterwards.
+ *
+ * @param[in]  None
+ * @param[out] None
+ * @return     None
+ */
+void Systick_EnableCycleCounter(void);
+
+/**
+ * @brief Get a free running timestamp in core cycles (DWT cycle counter).
+ *
+ * @param[in]  None
+ * @param[out] None
+ * @return     uint32 - Core cycles, the difference of two timestamps is valid across the wrap.
+ */
+uint32 Systick_GetTimestamp(void);
+
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+/**
+ * @brief Copy the interrupt latency / callback duration measurements.
+ *
+ * @param[in]  None
+ * @param[out] StatsPtr - Pointer to store the measurements.
+ * @return     None
+ */
+void Systick_GetJitterStats(Systick_JitterStatsType* StatsPtr);
+
+/**
+ * @brief Clear the interrupt latency / callback duration measurements.
+ *
+ * @param[in]   None
+ * @param[out]  None
+ * @return      None
+ */
+void Systick_ResetJitterStats(void);
+#endif
+
 //Std_ReturnType Systick_GetPredefTimerValue(Systick_PredefTimerType PredefTimer, uint32* TimeValuePtr);
 
 /**
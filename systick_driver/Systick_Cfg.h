@@ -64,6 +64,27 @@
 /* Pre-compile option to support SYSTICK as wakeup source */
 #define SystickReportWakeupSource      				(STD_ON)
 
+/* Pre-compile option for Systick_DelayUs / Systick_DelayCycles APIs */
+#define SYSTICK_DELAY_API                           (STD_ON)
+
+/* Pre-compile option to time the delays on the DWT cycle counter (STD_ON)
+ * or on the free running SysTick VAL register (STD_OFF) */
+#define SYSTICK_DELAY_USE_CYCLE_COUNTER             (STD_ON)
+
+/* Core (AHB) clock frequency in Hz, used to convert microseconds into cycles */
+#define SYSTICK_CORE_CLOCK_HZ                       (8000000UL)
+
+/* Pre-compile option to record the interrupt latency and callback duration in SysTick_Handler */
+#ifndef SYSTICK_JITTER_MEASUREMENT
+#define SYSTICK_JITTER_MEASUREMENT                  (STD_OFF)
+#endif
+
+/* Number of bins of the latency histogram, the last bin collects all longer latencies */
+#define SYSTICK_JITTER_HIST_BINS                    (16U)
+
+/* Width of one latency histogram bin in SysTick ticks */
+#define SYSTICK_JITTER_BIN_WIDTH                    (8U)
+
 /*******************************************************************************/
 
 #define NUM_OF_PORTS   3
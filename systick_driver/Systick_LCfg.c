@@ -13,10 +13,20 @@
 *   AUTOSAR Version  : R22-11
 *   SW Version       : 1.0.0
 ============================================================================*/
-extern void FUNC(void);
+extern void FUNC(void* Context);
 #include "Systick.h"
 
+#ifdef SYSTICK_HOST_SIMULATION
+/* Register file standing for SysTick, DWT, ICSR, DEMCR and PRIMASK in a host build */
+volatile SYSTICK_Regs Systick_SimulatedSystick;
+volatile DWT_Regs Systick_SimulatedDwt;
+volatile uint32 Systick_SimulatedIcsr;
+volatile uint32 Systick_SimulatedDemcr;
+volatile uint32 Systick_SimulatedPrimask;
+void (*Systick_SimulatedInterrupt)(void);
+#endif
+
 const Systick_ConfigType Systick_Configuration =
 {
-		SYSTICK_AHB_8, SYSTICK_PERIODIC_INTERVAL, FUNC
+		SYSTICK_AHB_8, SYSTICK_PERIODIC_INTERVAL, FUNC, NULL_PTR
 };
@@ -44,7 +44,58 @@ typedef struct
 /* Systick Base Addresses */
 #define SYSTICK_BASE_ADDRESS	((volatile uint32*)(0xE000E010))
 
+/*---------------------------------DWT (cycle counter) registers---------------------------------*/
+typedef struct
+{
+	volatile uint32 CTRL;
+	volatile uint32 CYCCNT;
+}DWT_Regs;
+
+/* DWT Base Address */
+#define DWT_BASE_ADDRESS		((volatile uint32*)(0xE0001000))
+
+/* Writing this bit to ICSR removes the pending state of the SysTick exception */
+#define SCB_ICSR_PENDSTCLR	(1UL << 25)
+
+#ifndef SYSTICK_HOST_SIMULATION
+
 #define SYSTICK	((volatile SYSTICK_Regs*)(SYSTICK_BASE_ADDRESS))
 
+#define DWT	((volatile DWT_Regs*)(DWT_BASE_ADDRESS))
+
+/* Interrupt Control and State Register (used to drop a pending SysTick interrupt) */
+#define SCB_ICSR			(*((volatile uint32*)(0xE000ED04)))
+
+/* Debug Exception and Monitor Control Register (holds the trace enable bit needed by DWT) */
+#define COREDEBUG_DEMCR		(*((volatile uint32*)(0xE000EDFC)))
+
+#else
+
+/*
+ * Host build: SysTick, DWT, ICSR and DEMCR are a simulated register file
+ * (defined in Systick_LCfg.c), the counters only change when the host writes them
+ */
+extern volatile SYSTICK_Regs Systick_SimulatedSystick;
+extern volatile DWT_Regs Systick_SimulatedDwt;
+extern volatile uint32 Systick_SimulatedIcsr;
+extern volatile uint32 Systick_SimulatedDemcr;
+
+/*
+ * PRIMASK of the host build, set by the critical sections of Systick.c. Where they unmask
+ * interrupts Systick_SimulatedInterrupt is called if set, a test takes SysTick_Handler from it
+ */
+extern volatile uint32 Systick_SimulatedPrimask;
+extern void (*Systick_SimulatedInterrupt)(void);
+
+#define SYSTICK	(&Systick_SimulatedSystick)
+
+#define DWT	(&Systick_SimulatedDwt)
+
+#define SCB_ICSR			(Systick_SimulatedIcsr)
+
+#define COREDEBUG_DEMCR		(Systick_SimulatedDemcr)
+
+#endif /* SYSTICK_HOST_SIMULATION */
+
 
 #endif
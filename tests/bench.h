@@ -0,0 +1,37 @@
+/**
+ *@file       bench.h
+ *@brief      Host benchmark support
+ *@details    A benchmark records one Prof probe measurement per batch of
+ *            BENCH_CALLS calls and reports the time of one call.
+ */
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdio.h>
+#include "Prof.h"
+
+/* Calls measured by one PROF_START / PROF_STOP pair, hides the cost of the probe */
+#define BENCH_CALLS		(1000U)
+
+/* Prints the shortest, mean and longest call of the batches recorded by probe ProbeId */
+static inline void Bench_Report(const char *Name, Prof_ProbeIdType ProbeId)
+{
+	Prof_StatsType Stats;
+
+	Prof_GetStats(ProbeId, &Stats);
+	if (Stats.Count != 0U)
+	{
+		printf("%-32s %8.2f %8.2f %8.2f " PROF_COUNTER_UNIT "/call (%lu batches)\n", Name,
+				(double) Stats.Min / BENCH_CALLS,
+				(double) Stats.Total / Stats.Count / BENCH_CALLS,
+				(double) Stats.Max / BENCH_CALLS, (unsigned long) Stats.Count);
+	}
+}
+
+/* Prints the column titles of Bench_Report */
+static inline void Bench_Header(const char *Title)
+{
+	printf("%-32s %8s %8s %8s\n", Title, "min", "mean", "max");
+}
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,56 @@
+/**
+ *@file       bench_dio.c
+ *@brief      Host benchmark of the Dio channel services
+ *@details    Dio_ReadChannel, Dio_WriteChannel and Dio_FlipChannel on every
+ *            one of the NUM_OF_PINS channels: the decode of the channel is the
+ *            same shift / mask for all of them, the times must not depend on the port.
+ */
+#include "Dio.h"
+#include "bench.h"
+
+#define BENCH_ROUNDS	(50U)
+
+static volatile Dio_LevelType Bench_Sink;
+
+static void Bench_Channels(const char *Name, uint8 Service)
+{
+	uint32 Round;
+	uint32 Channel;
+	uint32 Call;
+
+	Prof_Reset();
+	for (Round = 0U; Round < BENCH_ROUNDS; Round++)
+	{
+		for (Channel = 0U; Channel < NUM_OF_PINS; Channel++)
+		{
+			PROF_START(PROF_PROBE_DIO_WRITE);
+			for (Call = 0U; Call < BENCH_CALLS; Call++)
+			{
+				switch (Service)
+				{
+				case DIO_READ_CHANNEL_SID:
+					Bench_Sink = Dio_ReadChannel((Dio_ChannelType) Channel);
+					break;
+				case DIO_WRITE_CHANNEL_SID:
+					Dio_WriteChannel((Dio_ChannelType) Channel, (Dio_LevelType) (Call & STD_HIGH));
+					break;
+				default:
+					Bench_Sink = Dio_FlipChannel((Dio_ChannelType) Channel);
+					break;
+				}
+			}
+			PROF_STOP(PROF_PROBE_DIO_WRITE);
+		}
+	}
+	Bench_Report(Name, PROF_PROBE_DIO_WRITE);
+}
+
+int main(void)
+{
+	Prof_Init();
+	Bench_Header("all channels A0..C15");
+	Bench_Channels("Dio_ReadChannel", DIO_READ_CHANNEL_SID);
+	Bench_Channels("Dio_WriteChannel", DIO_WRITE_CHANNEL_SID);
+	Bench_Channels("Dio_FlipChannel", DIO_FLIP_CHANNEL_SID);
+	return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ *@file       bench_dio_softpwm.c
+ *@brief      Host benchmark of the Dio software PWM
+ *@details    Dio_SoftPwmTick, the timer callback run on every PWM tick, and
+ *            Dio_SoftPwmSetDuty, which builds the table of the next period, for
+ *            1, 2, 4 ... DIO_SOFT_PWM_CONFIGURED_CHANNELS channels driven
+ *            (bench_dio_softpwm_cfg.h), each with its own falling edge.
+ */
+#include <stdio.h>
+#include "Dio_SoftPwm.h"
+#include "bench.h"
+
+#define BENCH_BATCHES	(200U)
+
+/* Duty of channel Channel: distinct ticks, so every driven channel adds an edge */
+#define BENCH_DUTY(Channel)	((Dio_SoftPwmDutyType) (1U + ((Channel) * 7U)))
+
+/* Drives the first Driven channels, the others stay off */
+static void Bench_Drive(uint32 Driven)
+{
+	uint32 Channel;
+
+	for (Channel = 0U; Channel < DIO_SOFT_PWM_CONFIGURED_CHANNELS; Channel++)
+	{
+		Dio_SoftPwmSetDuty((Dio_SoftPwmChannelType) Channel,
+				(Channel < Driven) ? BENCH_DUTY(Channel) : 0U);
+	}
+}
+
+int main(void)
+{
+	char Name[32];
+	uint32 Driven;
+	uint32 Batch;
+	uint32 Call;
+
+	Prof_Init();
+	Dio_SoftPwmInit();
+
+	Bench_Header("Dio_SoftPwmTick");
+	for (Driven = 1U; Driven <= DIO_SOFT_PWM_CONFIGURED_CHANNELS; Driven *= 2U)
+	{
+		Bench_Drive(Driven);
+		Prof_Reset();
+		for (Batch = 0U; Batch < BENCH_BATCHES; Batch++)
+		{
+			PROF_START(PROF_PROBE_SOFT_PWM_TICK);
+			for (Call = 0U; Call < BENCH_CALLS; Call++)
+			{
+				Dio_SoftPwmTick(NULL_PTR);
+			}
+			PROF_STOP(PROF_PROBE_SOFT_PWM_TICK);
+		}
+		(void) snprintf(Name, sizeof(Name), "%lu channels", (unsigned long) Driven);
+		Bench_Report(Name, PROF_PROBE_SOFT_PWM_TICK);
+	}
+
+	Bench_Header("Dio_SoftPwmSetDuty");
+	for (Driven = 1U; Driven <= DIO_SOFT_PWM_CONFIGURED_CHANNELS; Driven *= 2U)
+	{
+		Bench_Drive(Driven);
+		Prof_Reset();
+		for (Batch = 0U; Batch < BENCH_BATCHES; Batch++)
+		{
+			PROF_START(PROF_PROBE_SOFT_PWM_SET_DUTY);
+			for (Call = 0U; Call < BENCH_CALLS; Call++)
+			{
+				/* rewrites the duty of a driven channel, the table keeps its edges */
+				Dio_SoftPwmSetDuty((Dio_SoftPwmChannelType) (Call % Driven),
+						BENCH_DUTY(Call % Driven));
+			}
+			PROF_STOP(PROF_PROBE_SOFT_PWM_SET_DUTY);
+		}
+		(void) snprintf(Name, sizeof(Name), "%lu channels", (unsigned long) Driven);
+		Bench_Report(Name, PROF_PROBE_SOFT_PWM_SET_DUTY);
+	}
+	return 0;
+}
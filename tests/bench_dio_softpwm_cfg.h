@@ -0,0 +1,15 @@
+/**
+ *@file       bench_dio_softpwm_cfg.h
+ *@brief      Software PWM configuration of bench_dio_softpwm
+ *@details    Force-included by the Makefile ahead of DIo_Cfg.h: the benchmark runs on the
+ *            largest configuration, 32 channels on ports A and B, and drives the first N.
+ */
+#ifndef BENCH_DIO_SOFTPWM_CFG_H_
+#define BENCH_DIO_SOFTPWM_CFG_H_
+
+#define DIO_SOFT_PWM_CONFIGURED_CHANNELS   32
+#define DIO_SOFT_PWM_CHANNEL_LIST \
+	A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, \
+	B0, B1, B2, B3, B4, B5, B6, B7, B8, B9, B10, B11, B12, B13, B14, B15
+
+#endif /* BENCH_DIO_SOFTPWM_CFG_H_ */
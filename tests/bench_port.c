@@ -0,0 +1,70 @@
+/**
+ *@file       bench_port.c
+ *@brief      Host benchmark of the Port pin lookup
+ *@details    Port_GetConfigIndex, used by Port_SetPinDirection / Port_SetPinMode,
+ *            on every pin id against the scan of the configuration it replaced.
+ */
+#include "port.h"
+#include "port_private.h"
+#include "bench.h"
+
+#define BENCH_ROUNDS	(200U)
+
+static volatile uint8 Bench_Sink;
+
+/* Search of the pin in the configuration array, the lookup before the pin index table */
+static uint8 Bench_ScanConfigIndex(uint8 copy_pinId)
+{
+	uint8 index;
+
+	for (index = 0; index < PORT_CONFIGURED_PINS; index++)
+	{
+		if (Port_Configuration.arr[index].pin_id == copy_pinId)
+		{
+			return index;
+		}
+	}
+	return PORT_INVALID_CONFIG_INDEX;
+}
+
+int main(void)
+{
+	uint32 Round;
+	uint32 Call;
+	uint8 PinId;
+
+	for (PinId = 0U; PinId < PORT_PIN_ID_COUNT; PinId++)
+	{
+		if (Port_GetConfigIndex(PinId) != Bench_ScanConfigIndex(PinId))
+		{
+			printf("pin id %u: the pin index table does not match the configuration\n", PinId);
+			return 1;
+		}
+	}
+
+	Prof_Init();
+	Bench_Header("all pin ids");
+	for (Round = 0U; Round < BENCH_ROUNDS; Round++)
+	{
+		PROF_START(PROF_PROBE_PORT_LOOKUP);
+		for (Call = 0U; Call < BENCH_CALLS; Call++)
+		{
+			Bench_Sink = Port_GetConfigIndex((uint8) (Call % PORT_PIN_ID_COUNT));
+		}
+		PROF_STOP(PROF_PROBE_PORT_LOOKUP);
+	}
+	Bench_Report("Port_GetConfigIndex", PROF_PROBE_PORT_LOOKUP);
+
+	Prof_Reset();
+	for (Round = 0U; Round < BENCH_ROUNDS; Round++)
+	{
+		PROF_START(PROF_PROBE_PORT_LOOKUP);
+		for (Call = 0U; Call < BENCH_CALLS; Call++)
+		{
+			Bench_Sink = Bench_ScanConfigIndex((uint8) (Call % PORT_PIN_ID_COUNT));
+		}
+		PROF_STOP(PROF_PROBE_PORT_LOOKUP);
+	}
+	Bench_Report("scan of Port_Configuration", PROF_PROBE_PORT_LOOKUP);
+	return 0;
+}
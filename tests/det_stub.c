@@ -0,0 +1,32 @@
+/**
+ *@file       det_stub.c
+ *@brief      Host test support
+ *@details    Det_ReportError of the host tests, the reports are recorded for the checks.
+ */
+#include "Det.h"
+#include "test.h"
+
+uint32 Test_Failures;
+
+uint32 Test_DetCount;
+uint16 Test_DetModule;
+uint8 Test_DetApi;
+uint8 Test_DetError;
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+	(void) InstanceId;
+	Test_DetCount++;
+	Test_DetModule = ModuleId;
+	Test_DetApi = ApiId;
+	Test_DetError = ErrorId;
+	return E_OK;
+}
+
+void Test_DetClear(void)
+{
+	Test_DetCount = 0U;
+	Test_DetModule = 0U;
+	Test_DetApi = 0U;
+	Test_DetError = 0U;
+}
@@ -0,0 +1,2 @@
+/* Host build: the drivers include "Dio_Cfg.h", the header in the tree is dio_driver/DIo_Cfg.h */
+#include "../../dio_driver/DIo_Cfg.h"
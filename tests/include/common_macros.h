@@ -0,0 +1,2 @@
+/* Host build: the drivers include "common_macros.h", the header in the tree is port_driver/Common_Macros.h */
+#include "../../port_driver/Common_Macros.h"
@@ -0,0 +1,2 @@
+/* Host build: the drivers include "port.h", the header in the tree is port_driver/Port.h */
+#include "../../port_driver/Port.h"
@@ -0,0 +1,2 @@
+/* Host build: the drivers include "std_types.h", the header in the tree is port_driver/Std_Types.h */
+#include "../../port_driver/Std_Types.h"
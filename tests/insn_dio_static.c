@@ -0,0 +1,34 @@
+/**
+ *@file       insn_dio_static.c
+ *@brief      Instruction count of the Dio static channel accesses
+ *@details    Compiled to an object only (make -C tests insn): each function holds one
+ *            access of a DIO_STATIC_CHANNELS channel, its instructions are counted with
+ *            objdump next to the Dio_WriteChannel / Dio_ReadChannel bodies of Dio.o.
+ */
+#include "Dio.h"
+
+void Insn_StaticWrite(Dio_LevelType Level);
+Dio_LevelType Insn_StaticRead(void);
+void Insn_ApiWrite(Dio_LevelType Level);
+Dio_LevelType Insn_ApiRead(void);
+
+void Insn_StaticWrite(Dio_LevelType Level)
+{
+	DIO_STATIC_WRITE(LED_STATUS, Level);
+}
+
+Dio_LevelType Insn_StaticRead(void)
+{
+	return DIO_STATIC_READ(USER_BUTTON);
+}
+
+/* Call sites of the services for the same channels, the service bodies are counted apart */
+void Insn_ApiWrite(Dio_LevelType Level)
+{
+	Dio_WriteChannel(DIO_LED_STATUS, Level);
+}
+
+Dio_LevelType Insn_ApiRead(void)
+{
+	return Dio_ReadChannel(DIO_USER_BUTTON);
+}
@@ -0,0 +1,44 @@
+/**
+ *@file       test.h
+ *@brief      Host test support
+ *@details    Check macros and the Det / UART stubs shared by the host tests.
+ */
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <stdio.h>
+#include "Std_Types.h"
+
+/* Number of failed checks of the running test program */
+extern uint32 Test_Failures;
+
+/* Reports a failed check with its location, the test goes on */
+#define TEST_CHECK(COND)	do { if (!(COND)) { Test_Failures++; \
+		printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); } } while (0)
+
+/* Same as TEST_CHECK for an equality, both values are printed on a failure */
+#define TEST_CHECK_EQ(ACTUAL, EXPECTED)	do { unsigned long Test_A = (unsigned long)(ACTUAL); \
+		unsigned long Test_E = (unsigned long)(EXPECTED); if (Test_A != Test_E) { Test_Failures++; \
+		printf("%s:%d: %s is 0x%lx, expected 0x%lx\n", __FILE__, __LINE__, #ACTUAL, Test_A, Test_E); } } while (0)
+
+/* Runs one test function */
+#define TEST_RUN(FUNCTION)	do { Test_DetClear(); FUNCTION(); } while (0)
+
+/* Ends main: prints the result and returns the exit status */
+#define TEST_END()	(printf("%s: %lu failed checks\n", __FILE__, (unsigned long)Test_Failures), \
+		(Test_Failures == 0U) ? 0 : 1)
+
+/* Det stub (det_stub.c): reports are counted instead of stopping */
+extern uint32 Test_DetCount;
+extern uint16 Test_DetModule;
+extern uint8 Test_DetApi;
+extern uint8 Test_DetError;
+void Test_DetClear(void);
+
+/* UART stub (uart_stub.c): transmitted strings are appended to Test_UartBuffer */
+#define TEST_UART_BUFFER_SIZE	(16384U)
+extern char Test_UartBuffer[TEST_UART_BUFFER_SIZE + 1U];
+extern uint32 Test_UartLength;
+void Test_UartClear(void);
+
+#endif /* TEST_H_ */
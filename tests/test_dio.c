@@ -0,0 +1,300 @@
+/**
+ *@file       test_dio.c
+ *@brief      Host test of the Dio driver
+ *@details    Channel, port and channel group accesses on the simulated GPIO
+ *            registers: every write must be a single BSRR store, or a store to
+ *            the ODR bit-band word of the channel when DIO_BITBAND_ACCESS is STD_ON.
+ */
+#include <string.h>
+#include "Dio.h"
+#include "test.h"
+
+extern const Dio_ChannelGroupType Dio_ChannelGroups[DIO_CONFIGURED_GROUPS];
+
+/* Fills the registers of every port with a pattern that no access writes */
+static void Test_FillPorts(void)
+{
+	uint32 Port;
+
+	for (Port = 0U; Port < NUM_OF_PORTS; Port++)
+	{
+		Dio_SimulatedPorts[Port].CRL = 0xA5A50000U | Port;
+		Dio_SimulatedPorts[Port].CRH = 0xA5A50010U | Port;
+		Dio_SimulatedPorts[Port].IDR = 0U;
+		Dio_SimulatedPorts[Port].ODR = 0U;
+		Dio_SimulatedPorts[Port].BSRR = 0xDEADBEEFU;
+		Dio_SimulatedPorts[Port].BRR = 0xDEADBEEFU;
+		Dio_SimulatedPorts[Port].LCK = 0xA5A50060U | Port;
+	}
+}
+
+/* TRUE if the registers of every port but BSRR of port WrittenPort still hold Expected */
+static boolean Test_OnlyBsrrWritten(const GPIO_REG *Expected, uint32 WrittenPort)
+{
+	GPIO_REG Actual[NUM_OF_PORTS];
+
+	memcpy(Actual, (const void *) Dio_SimulatedPorts, sizeof(Actual));
+	Actual[WrittenPort].BSRR = Expected[WrittenPort].BSRR;
+	return (memcmp(Actual, Expected, sizeof(Actual)) == 0) ? TRUE : FALSE;
+}
+
+static void Test_ChannelDecode(void)
+{
+	uint32 Channel;
+	uint32 Port;
+	uint32 Bit;
+	GPIO_REG Before[NUM_OF_PORTS];
+
+	for (Channel = 0U; Channel < NUM_OF_PINS; Channel++)
+	{
+		Port = Channel / 16U;
+		Bit = (uint32) 1U << (Channel % 16U);
+
+		Test_FillPorts();
+#if (DIO_BITBAND_ACCESS == STD_ON)
+		/* the bit-band word changes the ODR bit of the channel only */
+		Dio_SimulatedPorts[Port].ODR = 0x5A5AU & ~Bit;
+		memcpy(Before, (const void *) Dio_SimulatedPorts, sizeof(Before));
+		Dio_WriteChannel((Dio_ChannelType) Channel, STD_HIGH);
+		TEST_CHECK_EQ(Dio_SimulatedPorts[Port].ODR, (0x5A5AU & ~Bit) | Bit);
+		Dio_WriteChannel((Dio_ChannelType) Channel, STD_LOW);
+		TEST_CHECK_EQ(Dio_SimulatedPorts[Port].ODR, 0x5A5AU & ~Bit);
+		TEST_CHECK(memcmp(Before, (const void *) Dio_SimulatedPorts, sizeof(Before)) == 0);
+#else
+		memcpy(Before, (const void *) Dio_SimulatedPorts, sizeof(Before));
+		Dio_WriteChannel((Dio_ChannelType) Channel, STD_HIGH);
+		TEST_CHECK_EQ(Dio_SimulatedPorts[Port].BSRR, Bit);
+		Dio_WriteChannel((Dio_ChannelType) Channel, STD_LOW);
+		TEST_CHECK_EQ(Dio_SimulatedPorts[Port].BSRR, Bit << 16);
+		TEST_CHECK(Test_OnlyBsrrWritten(Before, Port));
+#endif
+
+		Dio_SimulatedPorts[Port].IDR = Bit;
+		TEST_CHECK_EQ(Dio_ReadChannel((Dio_ChannelType) Channel), STD_HIGH);
+		Dio_SimulatedPorts[Port].IDR = ~Bit & 0xFFFFU;
+		TEST_CHECK_EQ(Dio_ReadChannel((Dio_ChannelType) Channel), STD_LOW);
+	}
+
+	Dio_WriteChannel((Dio_ChannelType) NUM_OF_PINS, STD_HIGH);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	TEST_CHECK_EQ(Dio_ReadChannel((Dio_ChannelType) NUM_OF_PINS), STD_LOW);
+	TEST_CHECK_EQ(Test_DetApi, DIO_READ_CHANNEL_SID);
+	TEST_CHECK_EQ(Test_DetCount, 2U);
+}
+
+/* What the GPIO does with the BSRR store of a port: set bits win over reset bits */
+static void Test_ApplyBsrr(uint32 Port)
+{
+	uint32 Bsrr = Dio_SimulatedPorts[Port].BSRR;
+
+	Dio_SimulatedPorts[Port].ODR = ((Dio_SimulatedPorts[Port].ODR & ~(Bsrr >> 16)) | Bsrr) & 0xFFFFU;
+}
+
+static void Test_FlipAgainstInterrupts(void)
+{
+	uint32 Seed = 12345U;
+	uint32 Iteration;
+	uint32 Channel;
+	uint32 Port;
+	uint32 Bit;
+	uint32 Level;
+	uint32 Interrupt;
+	Dio_LevelType Returned;
+
+	Test_FillPorts();
+	for (Iteration = 0U; Iteration < 10000U; Iteration++)
+	{
+		Seed = (Seed * 1103515245U) + 12345U;
+		Channel = (Seed >> 8) % NUM_OF_PINS;
+		Port = Channel / 16U;
+		Bit = (uint32) 1U << (Channel % 16U);
+		Level = Dio_SimulatedPorts[Port].ODR & Bit;
+
+		Returned = Dio_FlipChannel((Dio_ChannelType) Channel);
+		/* an interrupt changes the other pins between the ODR read of the flip
+		 * and its store reaching the port, the store must not undo it */
+		Interrupt = (Seed >> 12) & 0xFFFFU & ~Bit;
+		Dio_SimulatedPorts[Port].ODR = (Dio_SimulatedPorts[Port].ODR & Bit) | Interrupt;
+		Test_ApplyBsrr(Port);
+
+		TEST_CHECK_EQ(Dio_SimulatedPorts[Port].ODR, Interrupt | (Level ^ Bit));
+		TEST_CHECK_EQ(Returned, (Level == 0U) ? STD_HIGH : STD_LOW);
+	}
+
+	TEST_CHECK_EQ(Dio_FlipChannel((Dio_ChannelType) NUM_OF_PINS), STD_LOW);
+	TEST_CHECK_EQ(Test_DetApi, DIO_FLIP_CHANNEL_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+}
+
+static void Test_GroupWrite(void)
+{
+	const Dio_ChannelGroupType *Group = &Dio_ChannelGroups[0];
+	GPIO_REG Before[NUM_OF_PORTS];
+
+	Test_FillPorts();
+	memcpy(Before, (const void *) Dio_SimulatedPorts, sizeof(Before));
+	Dio_WriteChannelGroup(Group, 0xA5U);
+	/* PB8..PB15: the set half holds the ones of the group, the reset half its zeros */
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTB].BSRR, 0x5A00A500U);
+	TEST_CHECK(Test_OnlyBsrrWritten(Before, PORTB));
+
+	/* bits of Level above the group width are dropped by the mask */
+	Dio_WriteChannelGroup(Group, 0x1FFU);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTB].BSRR, 0x0000FF00U);
+	Dio_WriteChannelGroup(Group, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTB].BSRR, 0xFF000000U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_GroupRead(void)
+{
+	const Dio_ChannelGroupType Group = { 0x0078U, 3U, PORTC };
+
+	Test_FillPorts();
+	Dio_SimulatedPorts[PORTC].IDR = 0xFFA9U;
+	TEST_CHECK_EQ(Dio_ReadChannelGroup(&Group), 0x5U);
+	TEST_CHECK_EQ(Dio_ReadChannelGroup(&Dio_ChannelGroups[0]), 0U);
+	Dio_SimulatedPorts[PORTB].IDR = 0x3C00U;
+	TEST_CHECK_EQ(Dio_ReadChannelGroup(&Dio_ChannelGroups[0]), 0x3CU);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_GroupErrors(void)
+{
+	const Dio_ChannelGroupType Group = { 0x00FFU, 0U, (Dio_PortType) NUM_OF_PORTS };
+	GPIO_REG Before[NUM_OF_PORTS];
+
+	Test_FillPorts();
+	memcpy(Before, (const void *) Dio_SimulatedPorts, sizeof(Before));
+	Dio_WriteChannelGroup(NULL_PTR, 0xFFU);
+	TEST_CHECK_EQ(Test_DetApi, DIO_WRITE_CHANNEL_GROUP_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_POINTER);
+	Dio_WriteChannelGroup(&Group, 0xFFU);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_GROUP);
+	TEST_CHECK(memcmp(Before, (const void *) Dio_SimulatedPorts, sizeof(Before)) == 0);
+
+	TEST_CHECK_EQ(Dio_ReadChannelGroup(&Group), STD_PORTLOW);
+	TEST_CHECK_EQ(Test_DetApi, DIO_READ_CHANNEL_GROUP_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_GROUP);
+	TEST_CHECK_EQ(Test_DetCount, 3U);
+}
+
+/* Groups whose mask does not start at the offset or has a gap are rejected, nothing is written */
+static void Test_GroupShape(void)
+{
+	const Dio_ChannelGroupType Groups[] = {
+		{ 0x0000U, 0U, PORTA },		/* no pin */
+		{ 0xFF00U, 16U, PORTA },	/* offset beyond the port */
+		{ 0xFF00U, 4U, PORTA },		/* lowest mask bit above the offset */
+		{ 0x0FF0U, 8U, PORTA },		/* mask bits below the offset */
+		{ 0x0F0FU, 0U, PORTA },		/* gap in the mask */
+	};
+	const Dio_ChannelGroupType Top = { 0x8000U, 15U, PORTA };
+	GPIO_REG Before[NUM_OF_PORTS];
+	uint32 Index;
+
+	Test_FillPorts();
+	memcpy(Before, (const void *) Dio_SimulatedPorts, sizeof(Before));
+	for (Index = 0U; Index < (sizeof(Groups) / sizeof(Groups[0])); Index++)
+	{
+		Test_DetClear();
+		Dio_WriteChannelGroup(&Groups[Index], 0xFFFFU);
+		TEST_CHECK_EQ(Test_DetApi, DIO_WRITE_CHANNEL_GROUP_SID);
+		TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_GROUP);
+		TEST_CHECK_EQ(Dio_ReadChannelGroup(&Groups[Index]), STD_PORTLOW);
+		TEST_CHECK_EQ(Test_DetApi, DIO_READ_CHANNEL_GROUP_SID);
+		TEST_CHECK_EQ(Test_DetCount, 2U);
+	}
+	TEST_CHECK(memcmp(Before, (const void *) Dio_SimulatedPorts, sizeof(Before)) == 0);
+
+	/* a single pin at the top of the port is a valid group */
+	Test_DetClear();
+	Dio_WriteChannelGroup(&Top, 1U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0x00008000U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+/* Static accesses of DIO_STATIC_CHANNELS, called through a table by Test_StaticAccess */
+#define TEST_STATIC_ACCESS(NAME, CHANNEL) \
+	static void Test_StaticWrite_##NAME(Dio_LevelType Level) { DIO_STATIC_WRITE(NAME, Level); } \
+	static Dio_LevelType Test_StaticRead_##NAME(void) { return DIO_STATIC_READ(NAME); }
+DIO_STATIC_CHANNELS(TEST_STATIC_ACCESS)
+
+typedef struct
+{
+	Dio_ChannelType Channel;
+	void (*Write)(Dio_LevelType Level);
+	Dio_LevelType (*Read)(void);
+} Test_StaticChannelType;
+
+#define TEST_STATIC_ENTRY(NAME, CHANNEL)	{ (CHANNEL), Test_StaticWrite_##NAME, Test_StaticRead_##NAME },
+static const Test_StaticChannelType Test_StaticChannels[] = {
+	DIO_STATIC_CHANNELS(TEST_STATIC_ENTRY)
+};
+
+/* Ports filled for a write whose output is compared: ODR holds a pattern, BSRR nothing to apply */
+static void Test_FillOutputs(void)
+{
+	uint32 Port;
+
+	Test_FillPorts();
+	for (Port = 0U; Port < NUM_OF_PORTS; Port++)
+	{
+		Dio_SimulatedPorts[Port].ODR = 0x5A5AU;
+		Dio_SimulatedPorts[Port].BSRR = 0U;
+	}
+}
+
+/* DIO_STATIC_WRITE / DIO_STATIC_READ reach the same pins as Dio_WriteChannel / Dio_ReadChannel */
+static void Test_StaticAccess(void)
+{
+	const uint32 Inputs[] = { 0x0000U, 0xFFFFU, 0x2001U, 0xDFFEU };
+	GPIO_REG Static[NUM_OF_PORTS];
+	uint32 Index;
+	uint32 Port;
+	uint32 Level;
+	uint32 Input;
+
+	for (Index = 0U; Index < (sizeof(Test_StaticChannels) / sizeof(Test_StaticChannels[0])); Index++)
+	{
+		Port = DIO_CHANNEL_PORT(Test_StaticChannels[Index].Channel);
+		for (Level = STD_LOW; Level <= STD_HIGH; Level++)
+		{
+			Test_FillOutputs();
+			Test_StaticChannels[Index].Write((Dio_LevelType) Level);
+			Test_ApplyBsrr(Port);
+			memcpy(Static, (const void *) Dio_SimulatedPorts, sizeof(Static));
+			TEST_CHECK_EQ(Static[Port].ODR, (0x5A5AU & ~DIO_CHANNEL_MASK(Test_StaticChannels[Index].Channel))
+					| (Level << DIO_CHANNEL_PIN(Test_StaticChannels[Index].Channel)));
+
+			Test_FillOutputs();
+			Dio_WriteChannel(Test_StaticChannels[Index].Channel, (Dio_LevelType) Level);
+			Test_ApplyBsrr(Port);
+#if (DIO_BITBAND_ACCESS == STD_ON)
+			/* the bit-band word leaves BSRR alone, the output is the same */
+			Static[Port].BSRR = Dio_SimulatedPorts[Port].BSRR;
+#endif
+			TEST_CHECK(memcmp(Static, (const void *) Dio_SimulatedPorts, sizeof(Static)) == 0);
+		}
+		for (Input = 0U; Input < (sizeof(Inputs) / sizeof(Inputs[0])); Input++)
+		{
+			Dio_SimulatedPorts[Port].IDR = Inputs[Input];
+			TEST_CHECK_EQ(Test_StaticChannels[Index].Read(),
+					Dio_ReadChannel(Test_StaticChannels[Index].Channel));
+		}
+	}
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+int main(void)
+{
+	TEST_RUN(Test_ChannelDecode);
+	TEST_RUN(Test_FlipAgainstInterrupts);
+	TEST_RUN(Test_GroupWrite);
+	TEST_RUN(Test_GroupRead);
+	TEST_RUN(Test_GroupErrors);
+	TEST_RUN(Test_GroupShape);
+	TEST_RUN(Test_StaticAccess);
+	return TEST_END();
+}
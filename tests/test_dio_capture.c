@@ -0,0 +1,201 @@
+/**
+ *@file       test_dio_capture.c
+ *@brief      Host test of the Dio logic capture
+ *@details    Dio_CaptureTick samples the simulated IDR registers, the VCD text
+ *            of Dio_CaptureDump is read back from the UART stub.
+ */
+#include <string.h>
+#include "Dio_Capture.h"
+#include "test.h"
+
+/* A0 and A1 captured, trigger on A1 high, four samples from the trigger on */
+static const Dio_CaptureConfigType Test_Config = {
+	{ 0x0003U, 0x0000U, 0x0000U },
+	{ 0x0002U, 0x0000U, 0x0000U },
+	{ 0x0002U, 0x0000U, 0x0000U },
+	4U
+};
+
+static void Test_TickA(uint32 Idr)
+{
+	Dio_SimulatedPorts[PORTA].IDR = Idr;
+	Dio_CaptureTick(NULL_PTR);
+}
+
+/* Number of lines of the dump starting with Character */
+static uint32 Test_CountLines(char Character)
+{
+	uint32 Lines = 0U;
+	const char *Text = Test_UartBuffer;
+
+	while (Text != NULL_PTR)
+	{
+		if (*Text == Character)
+		{
+			Lines++;
+		}
+		Text = strchr(Text, '\n');
+		if (Text != NULL_PTR)
+		{
+			Text++;
+		}
+	}
+	return Lines;
+}
+
+static void Test_TriggerAndVcd(void)
+{
+	static const char Expected[] =
+		"$timescale 1 us $end\n"
+		"$scope module dio $end\n"
+		"$var wire 1 ! A0 $end\n"
+		"$var wire 1 \" A1 $end\n"
+		"$upscope $end\n"
+		"$enddefinitions $end\n"
+		"#0\n0!\n0\"\n"
+		"#2000\n1!\n"
+		"$comment trigger $end\n"
+		"#3000\n1\"\n"
+		"#5000\n0!\n"
+		"#6000\n0\"\n"
+		"#7000\n";
+
+	Test_UartClear();
+	Dio_CaptureStart(&Test_Config);
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_ARMED);
+	Test_TickA(0x0000U);
+	Test_TickA(0xFFF0U);
+	Test_TickA(0x0001U);
+	/* no dump while the capture runs */
+	TEST_CHECK_EQ(Dio_CaptureDump(UART1), E_NOT_OK);
+	Test_TickA(0x0003U);
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_TRIGGERED);
+	Test_TickA(0x0003U);
+	Test_TickA(0x0002U);
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_TRIGGERED);
+	/* the fourth sample from the trigger on ends the capture */
+	Test_TickA(0x0000U);
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_DONE);
+	Test_TickA(0x0001U);
+
+	TEST_CHECK_EQ(Test_UartLength, 0U);
+	TEST_CHECK_EQ(Dio_CaptureDump(UART1), E_OK);
+	TEST_CHECK(strcmp(Test_UartBuffer, Expected) == 0);
+	if (strcmp(Test_UartBuffer, Expected) != 0)
+	{
+		printf("%s", Test_UartBuffer);
+	}
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_PreTriggerWrap(void)
+{
+	uint32 Tick;
+
+	Test_UartClear();
+	Dio_CaptureStart(&Test_Config);
+	/* more changes than the buffer holds before the trigger, the oldest are dropped */
+	for (Tick = 0U; Tick < (DIO_CAPTURE_BUFFER_SIZE + 40U); Tick++)
+	{
+		Test_TickA(Tick & 1U);
+	}
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_ARMED);
+	Test_TickA(0x0002U);
+	Dio_CaptureStop();
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_DONE);
+
+	TEST_CHECK_EQ(Dio_CaptureDump(UART2), E_OK);
+	/* one time line per entry and the end time */
+	TEST_CHECK_EQ(Test_CountLines('#'), DIO_CAPTURE_BUFFER_SIZE + 1U);
+	TEST_CHECK(strstr(Test_UartBuffer, "$comment trigger $end\n") != NULL_PTR);
+	TEST_CHECK(strstr(Test_UartBuffer, "#127000\n") != NULL_PTR);
+	TEST_CHECK(strstr(Test_UartBuffer, "#128000\n") != NULL_PTR);
+	TEST_CHECK(strstr(Test_UartBuffer, "#129000\n") == NULL_PTR);
+}
+
+static void Test_LongRun(void)
+{
+	uint32 Tick;
+
+	Test_UartClear();
+	Dio_CaptureStart(&Test_Config);
+	/* a level held longer than an entry counts continues in a new entry */
+	for (Tick = 0U; Tick < 0x10004U; Tick++)
+	{
+		Test_TickA(0x0001U);
+	}
+	Dio_CaptureStop();
+	TEST_CHECK_EQ(Dio_CaptureDump(UART1), E_OK);
+	TEST_CHECK_EQ(Test_CountLines('#'), 3U);
+	TEST_CHECK(strstr(Test_UartBuffer, "#65535000\n#65540000\n") != NULL_PTR);
+}
+
+/* A level held after the trigger still ends the capture after the post-trigger samples */
+static void Test_StableAfterTrigger(void)
+{
+	uint32 Tick;
+
+	Test_UartClear();
+	Dio_CaptureStart(&Test_Config);
+	Test_TickA(0x0000U);
+	Test_TickA(0x0002U);
+	for (Tick = 0U; Tick < 2U; Tick++)
+	{
+		Test_TickA(0x0002U);
+	}
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_TRIGGERED);
+	Test_TickA(0x0002U);
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_DONE);
+
+	TEST_CHECK_EQ(Dio_CaptureDump(UART1), E_OK);
+	/* the pre-trigger entry, the trigger entry lasting four ticks and the end time */
+	TEST_CHECK(strstr(Test_UartBuffer, "$comment trigger $end\n#1000\n1\"\n#5000\n") != NULL_PTR);
+	TEST_CHECK_EQ(Test_CountLines('#'), 3U);
+}
+
+/* Without a sample count the capture ends before an entry would overwrite the trigger entry */
+static void Test_PostTriggerFillsBuffer(void)
+{
+	Dio_CaptureConfigType Config = Test_Config;
+	uint32 Tick;
+
+	Config.PostTriggerSamples = 0U;
+	Test_UartClear();
+	Dio_CaptureStart(&Config);
+	Test_TickA(0x0000U);
+	for (Tick = 0U; Tick < DIO_CAPTURE_BUFFER_SIZE; Tick++)
+	{
+		Test_TickA(0x0002U | (Tick & 1U));
+	}
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_TRIGGERED);
+	Test_TickA(0x0000U);
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_DONE);
+
+	TEST_CHECK_EQ(Dio_CaptureDump(UART1), E_OK);
+	TEST_CHECK_EQ(Test_CountLines('#'), DIO_CAPTURE_BUFFER_SIZE + 1U);
+	/* the oldest entry kept is the trigger entry */
+	TEST_CHECK(strstr(Test_UartBuffer, "$enddefinitions $end\n$comment trigger $end\n#0\n") != NULL_PTR);
+}
+
+static void Test_Errors(void)
+{
+	Dio_CaptureStart(&Test_Config);
+	Dio_CaptureStart(NULL_PTR);
+	TEST_CHECK_EQ(Test_DetApi, DIO_CAPTURE_START_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_CONFIG);
+	/* the running capture is kept */
+	TEST_CHECK_EQ(Dio_CaptureGetState(), DIO_CAPTURE_ARMED);
+	Dio_CaptureStop();
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+}
+
+int main(void)
+{
+	TEST_RUN(Test_TriggerAndVcd);
+	TEST_RUN(Test_PreTriggerWrap);
+	TEST_RUN(Test_LongRun);
+	TEST_RUN(Test_StableAfterTrigger);
+	TEST_RUN(Test_PostTriggerFillsBuffer);
+	TEST_RUN(Test_Errors);
+	return TEST_END();
+}
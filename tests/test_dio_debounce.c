@@ -0,0 +1,182 @@
+/**
+ *@file       test_dio_debounce.c
+ *@brief      Host test of the Dio debounce service
+ *@details    Dio_DebounceTick is called as the periodic timer callback on
+ *            samples written to the simulated IDR registers.
+ */
+#include "Dio_Debounce.h"
+#include "test.h"
+
+#define TEST_EVENTS		(8U)
+
+static uint32 Test_Events;
+static Dio_ChannelType Test_EventChannel[TEST_EVENTS];
+static Dio_EdgeType Test_EventEdge[TEST_EVENTS];
+
+static void Test_Notification(Dio_ChannelType ChannelId, Dio_EdgeType Edge)
+{
+	if (Test_Events < TEST_EVENTS)
+	{
+		Test_EventChannel[Test_Events] = ChannelId;
+		Test_EventEdge[Test_Events] = Edge;
+	}
+	Test_Events++;
+}
+
+/* PA0, PA1 and PC13 debounced */
+static const Dio_DebounceConfigType Test_Config = {
+	{ 0x0003U, 0x0000U, 0x2000U },
+	Test_Notification
+};
+
+/* Ticks once with the given IDR of port A */
+static void Test_TickA(uint32 Idr)
+{
+	Dio_SimulatedPorts[PORTA].IDR = Idr;
+	Dio_DebounceTick(NULL_PTR);
+}
+
+static void Test_Uninit(void)
+{
+	TEST_CHECK_EQ(Dio_DebounceReadChannel(A0), STD_LOW);
+	TEST_CHECK_EQ(Test_DetApi, DIO_DEBOUNCE_READ_CHANNEL_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_UNINIT);
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), STD_PORTLOW);
+	TEST_CHECK_EQ(Test_DetApi, DIO_DEBOUNCE_READ_PORT_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_UNINIT);
+	/* a tick before the init does nothing */
+	Dio_DebounceTick(NULL_PTR);
+	Dio_DebounceInit(NULL_PTR);
+	TEST_CHECK_EQ(Test_DetApi, DIO_DEBOUNCE_INIT_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_CONFIG);
+	TEST_CHECK_EQ(Test_DetCount, 3U);
+}
+
+static void Test_InitLevels(void)
+{
+	Dio_SimulatedPorts[PORTA].IDR = 0xFFFDU;
+	Dio_SimulatedPorts[PORTB].IDR = 0xFFFFU;
+	Dio_SimulatedPorts[PORTC].IDR = 0x2000U;
+	Dio_DebounceInit(&Test_Config);
+	/* only the configured pins are kept */
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), 0x0001U);
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTB), 0x0000U);
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTC), 0x2000U);
+	TEST_CHECK_EQ(Dio_DebounceReadChannel(A0), STD_HIGH);
+	TEST_CHECK_EQ(Dio_DebounceReadChannel(A1), STD_LOW);
+	TEST_CHECK_EQ(Dio_DebounceReadChannel(C13), STD_HIGH);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_Press(void)
+{
+	uint32 Tick;
+
+	Dio_SimulatedPorts[PORTC].IDR = 0x2000U;
+	Test_TickA(0x0001U);
+	Dio_DebounceInit(&Test_Config);
+	Test_Events = 0U;
+	/* A0 released, A1 pressed in the same samples: both change at the third one */
+	for (Tick = 1U; Tick < DIO_DEBOUNCE_SAMPLES; Tick++)
+	{
+		Test_TickA(0x0002U);
+		TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), 0x0001U);
+	}
+	Test_TickA(0x0002U);
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), 0x0002U);
+	TEST_CHECK_EQ(Test_Events, 2U);
+	TEST_CHECK_EQ(Test_EventChannel[0], A0);
+	TEST_CHECK_EQ(Test_EventEdge[0], DIO_EDGE_FALLING);
+	TEST_CHECK_EQ(Test_EventChannel[1], A1);
+	TEST_CHECK_EQ(Test_EventEdge[1], DIO_EDGE_RISING);
+	/* a stable input gives no further event */
+	Test_TickA(0x0002U);
+	Test_TickA(0x0002U);
+	Test_TickA(0x0002U);
+	TEST_CHECK_EQ(Test_Events, 2U);
+}
+
+static void Test_Bounce(void)
+{
+	Dio_SimulatedPorts[PORTC].IDR = 0x2000U;
+	Test_TickA(0x0000U);
+	Dio_DebounceInit(&Test_Config);
+	Test_Events = 0U;
+	/* a sample back at the debounced level restarts the count */
+	Test_TickA(0x0001U);
+	Test_TickA(0x0001U);
+	Test_TickA(0x0000U);
+	Test_TickA(0x0001U);
+	Test_TickA(0x0001U);
+	TEST_CHECK_EQ(Dio_DebounceReadChannel(A0), STD_LOW);
+	TEST_CHECK_EQ(Test_Events, 0U);
+	Test_TickA(0x0001U);
+	TEST_CHECK_EQ(Dio_DebounceReadChannel(A0), STD_HIGH);
+	TEST_CHECK_EQ(Test_Events, 1U);
+}
+
+static void Test_ToggleBack(void)
+{
+	uint32 Tick;
+
+	Dio_SimulatedPorts[PORTC].IDR = 0x2000U;
+	Test_TickA(0x0000U);
+	Dio_DebounceInit(&Test_Config);
+	Test_Events = 0U;
+	/* A0 pressed while A1 bounces once, A1 counts again from its next changed sample */
+	Test_TickA(0x0001U);
+	Test_TickA(0x0003U);
+	Test_TickA(0x0001U);
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), 0x0001U);
+	TEST_CHECK_EQ(Test_Events, 1U);
+	Test_TickA(0x0003U);
+	Test_TickA(0x0003U);
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), 0x0001U);
+	Test_TickA(0x0003U);
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), 0x0003U);
+
+	/* A1 released right after its toggle goes back after DIO_DEBOUNCE_SAMPLES samples, not one later */
+	Test_Events = 0U;
+	for (Tick = 1U; Tick < DIO_DEBOUNCE_SAMPLES; Tick++)
+	{
+		Test_TickA(0x0001U);
+	}
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), 0x0003U);
+	TEST_CHECK_EQ(Test_Events, 0U);
+	Test_TickA(0x0001U);
+	TEST_CHECK_EQ(Dio_DebounceReadPort(PORTA), 0x0001U);
+	TEST_CHECK_EQ(Test_Events, 1U);
+	TEST_CHECK_EQ(Test_EventChannel[0], A1);
+	TEST_CHECK_EQ(Test_EventEdge[0], DIO_EDGE_FALLING);
+
+	/* PC13 is debounced on its own port */
+	Dio_SimulatedPorts[PORTC].IDR = 0x0000U;
+	Test_TickA(0x0001U);
+	Test_TickA(0x0001U);
+	Test_TickA(0x0001U);
+	TEST_CHECK_EQ(Dio_DebounceReadChannel(C13), STD_LOW);
+	TEST_CHECK_EQ(Test_EventChannel[1], C13);
+}
+
+static void Test_Errors(void)
+{
+	Dio_DebounceInit(&Test_Config);
+	TEST_CHECK_EQ(Dio_DebounceReadChannel((Dio_ChannelType) NUM_OF_PINS), STD_LOW);
+	TEST_CHECK_EQ(Test_DetApi, DIO_DEBOUNCE_READ_CHANNEL_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	TEST_CHECK_EQ(Dio_DebounceReadPort((Dio_PortType) NUM_OF_PORTS), STD_PORTLOW);
+	TEST_CHECK_EQ(Test_DetApi, DIO_DEBOUNCE_READ_PORT_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_PORT_ID);
+	TEST_CHECK_EQ(Test_DetCount, 2U);
+}
+
+int main(void)
+{
+	TEST_RUN(Test_Uninit);
+	TEST_RUN(Test_InitLevels);
+	TEST_RUN(Test_Press);
+	TEST_RUN(Test_Bounce);
+	TEST_RUN(Test_ToggleBack);
+	TEST_RUN(Test_Errors);
+	return TEST_END();
+}
@@ -0,0 +1,185 @@
+/**
+ *@file       test_dio_exti.c
+ *@brief      Host test of the Dio external interrupt service
+ *@details    Line setup, event FIFO and overflow on the simulated EXTI, AFIO
+ *            and NVIC registers, the handlers are called as the interrupts.
+ */
+#include <string.h>
+#include "Dio_Exti.h"
+#include "test.h"
+
+extern const Dio_ExtiChannelConfigType Dio_ExtiChannels[DIO_EXTI_CONFIGURED_CHANNELS];
+
+/* Timestamp of the events, stands for the DWT cycle counter of Systick_GetTimestamp */
+static uint32 Test_Timestamp;
+uint32 Systick_GetTimestamp(void)
+{
+	return Test_Timestamp;
+}
+
+static uint32 Test_Notifications;
+static Dio_ExtiEventType Test_LastEvent;
+static void Test_Notification(const Dio_ExtiEventType *EventPtr)
+{
+	Test_Notifications++;
+	Test_LastEvent = *EventPtr;
+}
+
+static const Dio_ExtiChannelConfigType Test_C5Rising[DIO_EXTI_CONFIGURED_CHANNELS] = {
+	{ C5, DIO_EXTI_RISING_EDGE, Test_Notification }
+};
+
+static const Dio_ExtiChannelConfigType Test_A0Falling[DIO_EXTI_CONFIGURED_CHANNELS] = {
+	{ A0, DIO_EXTI_FALLING_EDGE, NULL_PTR }
+};
+
+static void Test_ResetRegisters(void)
+{
+	memset((void *) &Dio_SimulatedExti, 0, sizeof(Dio_SimulatedExti));
+	memset((void *) &Dio_SimulatedAfio, 0, sizeof(Dio_SimulatedAfio));
+	memset((void *) Dio_SimulatedPorts, 0, sizeof(GPIO_REG) * NUM_OF_PORTS);
+	Dio_SimulatedNvicIser[0] = 0U;
+	Dio_SimulatedNvicIser[1] = 0U;
+	Dio_SimulatedRccApb2enr = 0U;
+}
+
+/* Drops the events left in the FIFO by a previous test */
+static void Test_Drain(void)
+{
+	Dio_ExtiEventType Event;
+
+	while (Dio_ExtiReadEvent(&Event) == E_OK)
+	{
+	}
+}
+
+static void Test_Init(void)
+{
+	Test_ResetRegisters();
+	Dio_ExtiInit(NULL_PTR);
+	TEST_CHECK_EQ(Test_DetApi, DIO_EXTI_INIT_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_CONFIG);
+	TEST_CHECK_EQ(Dio_SimulatedExti.IMR, 0U);
+
+	/* PB0 both edges */
+	Dio_ExtiInit(Dio_ExtiChannels);
+	TEST_CHECK_EQ(Dio_SimulatedRccApb2enr, (uint32) 1U << RCC_APB2ENR_AFIOEN);
+	TEST_CHECK_EQ(Dio_SimulatedAfio.EXTICR[0], PORTB);
+	TEST_CHECK_EQ(Dio_SimulatedExti.RTSR, 0x0001U);
+	TEST_CHECK_EQ(Dio_SimulatedExti.FTSR, 0x0001U);
+	TEST_CHECK_EQ(Dio_SimulatedExti.IMR, 0x0001U);
+	TEST_CHECK_EQ(Dio_SimulatedExti.PR, 0x0001U);
+	TEST_CHECK_EQ(Dio_SimulatedNvicIser[0], (uint32) 1U << 6);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+}
+
+static void Test_Reinit(void)
+{
+	Test_ResetRegisters();
+	Dio_ExtiInit(Dio_ExtiChannels);
+	/* a new configuration frees the lines of the previous one */
+	Dio_ExtiInit(Test_C5Rising);
+	TEST_CHECK_EQ(Dio_SimulatedExti.IMR, 0x0020U);
+	TEST_CHECK_EQ(Dio_SimulatedAfio.EXTICR[1], (uint32) PORTC << 4);
+	TEST_CHECK_EQ(Dio_SimulatedExti.RTSR & 0x0020U, 0x0020U);
+	TEST_CHECK_EQ(Dio_SimulatedExti.FTSR & 0x0020U, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedNvicIser[0], (uint32) 1U << 23);
+
+	/* the same line on another port is accepted after a reinit */
+	Dio_ExtiInit(Dio_ExtiChannels);
+	Dio_ExtiInit(Test_A0Falling);
+	TEST_CHECK_EQ(Dio_SimulatedAfio.EXTICR[0] & 0x000FU, PORTA);
+	TEST_CHECK_EQ(Dio_SimulatedExti.RTSR & 0x0001U, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedExti.FTSR & 0x0001U, 0x0001U);
+	TEST_CHECK_EQ(Dio_SimulatedExti.IMR, 0x0001U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_Event(void)
+{
+	Dio_ExtiEventType Event;
+
+	Test_ResetRegisters();
+	Dio_ExtiInit(Test_C5Rising);
+	Test_Drain();
+	Test_Notifications = 0U;
+
+	Dio_SimulatedPorts[PORTC].IDR = 0x0020U;
+	Dio_SimulatedExti.PR = 0x0020U;
+	Test_Timestamp = 1234U;
+	EXTI9_5_IRQHandler();
+	/* the pending bit is written back to clear it */
+	TEST_CHECK_EQ(Dio_SimulatedExti.PR, 0x0020U);
+	TEST_CHECK_EQ(Test_Notifications, 1U);
+	TEST_CHECK_EQ(Test_LastEvent.ChannelId, C5);
+	TEST_CHECK_EQ(Test_LastEvent.Level, STD_HIGH);
+	TEST_CHECK_EQ(Test_LastEvent.Timestamp, 1234U);
+
+	TEST_CHECK_EQ(Dio_ExtiReadEvent(&Event), E_OK);
+	TEST_CHECK_EQ(Event.ChannelId, C5);
+	TEST_CHECK_EQ(Event.Level, STD_HIGH);
+	TEST_CHECK_EQ(Event.Timestamp, 1234U);
+	TEST_CHECK_EQ(Dio_ExtiReadEvent(&Event), E_NOT_OK);
+
+	/* a line freed by the reinit, or pending on another handler, gives no event */
+	Dio_SimulatedExti.PR = 0x0001U;
+	EXTI0_IRQHandler();
+	Dio_SimulatedExti.PR = 0x0020U;
+	EXTI15_10_IRQHandler();
+	TEST_CHECK_EQ(Dio_ExtiReadEvent(&Event), E_NOT_OK);
+	TEST_CHECK_EQ(Test_Notifications, 1U);
+
+	TEST_CHECK_EQ(Dio_ExtiReadEvent(NULL_PTR), E_NOT_OK);
+	TEST_CHECK_EQ(Test_DetApi, DIO_EXTI_READ_EVENT_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_POINTER);
+}
+
+static void Test_FifoOverflow(void)
+{
+	Dio_ExtiEventType Event;
+	uint32 Overflows;
+	uint32 Index;
+
+	Test_ResetRegisters();
+	Dio_ExtiInit(Test_C5Rising);
+	Test_Drain();
+	Overflows = Dio_ExtiGetOverflowCount();
+
+	/* four events more than the FIFO holds, the newest are dropped */
+	for (Index = 0U; Index < (DIO_EXTI_FIFO_SIZE + 4U); Index++)
+	{
+		Dio_SimulatedPorts[PORTC].IDR = (Index & 1U) << 5;
+		Dio_SimulatedExti.PR = 0x0020U;
+		Test_Timestamp = 100U * Index;
+		EXTI9_5_IRQHandler();
+	}
+	TEST_CHECK_EQ(Dio_ExtiGetOverflowCount() - Overflows, 4U);
+	for (Index = 0U; Index < DIO_EXTI_FIFO_SIZE; Index++)
+	{
+		TEST_CHECK_EQ(Dio_ExtiReadEvent(&Event), E_OK);
+		TEST_CHECK_EQ(Event.Timestamp, 100U * Index);
+		TEST_CHECK_EQ(Event.Level, Index & 1U);
+	}
+	TEST_CHECK_EQ(Dio_ExtiReadEvent(&Event), E_NOT_OK);
+
+	/* the slots read are free again, across the wrap of the indexes */
+	for (Index = 0U; Index < 300U; Index++)
+	{
+		Dio_SimulatedExti.PR = 0x0020U;
+		Test_Timestamp = Index;
+		EXTI9_5_IRQHandler();
+		TEST_CHECK_EQ(Dio_ExtiReadEvent(&Event), E_OK);
+		TEST_CHECK_EQ(Event.Timestamp, Index);
+	}
+	TEST_CHECK_EQ(Dio_ExtiGetOverflowCount() - Overflows, 4U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+int main(void)
+{
+	TEST_RUN(Test_Init);
+	TEST_RUN(Test_Reinit);
+	TEST_RUN(Test_Event);
+	TEST_RUN(Test_FifoOverflow);
+	return TEST_END();
+}
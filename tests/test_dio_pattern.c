@@ -0,0 +1,149 @@
+/**
+ *@file       test_dio_pattern.c
+ *@brief      Host test of the Dio pattern player
+ *@details    Dio_PatternTick is called as the periodic timer callback, the
+ *            BSRR store of every tick is read back from the simulated ports.
+ */
+#include <string.h>
+#include "Dio_Pattern.h"
+#include "test.h"
+
+/* A, two ticks later B and C in the same tick, one tick later A again: a pass lasts 3 ticks */
+static const Dio_PatternStepType Test_LoopSteps[] = {
+	{ PORTA, 0x00010000U, 2U },
+	{ PORTB, 0x00000002U, 0U },
+	{ PORTC, 0x00000004U, 1U }
+};
+static const Dio_PatternType Test_Loop = { Test_LoopSteps, 3U, TRUE };
+
+static const Dio_PatternStepType Test_OnceSteps[] = {
+	{ PORTA, 0x00000010U, 1U }
+};
+static const Dio_PatternType Test_Once = { Test_OnceSteps, 1U, FALSE };
+
+/* Every step without delay: a pass per tick, not an endless loop in the tick */
+static const Dio_PatternStepType Test_BurstSteps[] = {
+	{ PORTA, 0x00000001U, 0U },
+	{ PORTA, 0x00010000U, 0U }
+};
+static const Dio_PatternType Test_Burst = { Test_BurstSteps, 2U, TRUE };
+
+static const Dio_PatternStepType Test_BadSteps[] = {
+	{ PORTA, 0x00000001U, 0U },
+	{ (Dio_PortType) NUM_OF_PORTS, 0x00000001U, 0U }
+};
+
+/* Ticks once, returns the ports written by the tick as bits 0 (A), 1 (B) and 2 (C) */
+static uint32 Test_Tick(void)
+{
+	uint32 Written = 0U;
+	uint32 Port;
+
+	for (Port = 0U; Port < NUM_OF_PORTS; Port++)
+	{
+		Dio_SimulatedPorts[Port].BSRR = 0U;
+	}
+	Dio_PatternTick(NULL_PTR);
+	for (Port = 0U; Port < NUM_OF_PORTS; Port++)
+	{
+		if (Dio_SimulatedPorts[Port].BSRR != 0U)
+		{
+			Written |= (uint32) 1U << Port;
+		}
+	}
+	return Written;
+}
+
+static void Test_LoopTiming(void)
+{
+	static const uint8 Expected[] = { 1U, 0U, 6U, 1U, 0U, 6U, 1U, 0U, 6U, 1U };
+	uint32 Tick;
+
+	Dio_PatternStop();
+	TEST_CHECK_EQ(Dio_PatternIsBusy(), FALSE);
+	TEST_CHECK_EQ(Dio_PatternLoad(&Test_Loop), E_OK);
+	TEST_CHECK_EQ(Dio_PatternIsBusy(), TRUE);
+	for (Tick = 0U; Tick < sizeof(Expected); Tick++)
+	{
+		TEST_CHECK_EQ(Test_Tick(), Expected[Tick]);
+	}
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0x00010000U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_SwitchAtPassEnd(void)
+{
+	Dio_PatternStop();
+	Dio_PatternLoad(&Test_Loop);
+	TEST_CHECK_EQ(Test_Tick(), 1U);
+	/* Test_Once is loaded in the middle of a pass, the pass is finished first */
+	Dio_PatternLoad(&Test_Once);
+	TEST_CHECK_EQ(Test_Tick(), 0U);
+	TEST_CHECK_EQ(Test_Tick(), 6U);
+	TEST_CHECK_EQ(Test_Tick(), 1U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0x00000010U);
+	TEST_CHECK_EQ(Dio_PatternIsBusy(), TRUE);
+	/* the end of a pattern without loop is seen at its pass boundary */
+	TEST_CHECK_EQ(Test_Tick(), 0U);
+	TEST_CHECK_EQ(Dio_PatternIsBusy(), FALSE);
+	TEST_CHECK_EQ(Test_Tick(), 0U);
+}
+
+static void Test_Stop(void)
+{
+	Dio_PatternStop();
+	Dio_PatternLoad(&Test_Loop);
+	TEST_CHECK_EQ(Test_Tick(), 1U);
+	Dio_PatternStop();
+	TEST_CHECK_EQ(Dio_PatternIsBusy(), FALSE);
+	TEST_CHECK_EQ(Test_Tick(), 0U);
+	TEST_CHECK_EQ(Test_Tick(), 0U);
+	/* a new load starts from its first step without the delay of the stopped one */
+	Dio_PatternLoad(&Test_Once);
+	TEST_CHECK_EQ(Test_Tick(), 1U);
+}
+
+static void Test_NoDelay(void)
+{
+	uint32 Tick;
+
+	Dio_PatternStop();
+	Dio_PatternLoad(&Test_Burst);
+	for (Tick = 0U; Tick < 4U; Tick++)
+	{
+		/* the last store of the pass is the one left in BSRR */
+		TEST_CHECK_EQ(Test_Tick(), 1U);
+		TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0x00010000U);
+	}
+	Dio_PatternStop();
+}
+
+static void Test_LoadErrors(void)
+{
+	Dio_PatternType Pattern = { Test_BadSteps, 2U, FALSE };
+
+	Dio_PatternStop();
+	TEST_CHECK_EQ(Dio_PatternLoad(NULL_PTR), E_NOT_OK);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_POINTER);
+	TEST_CHECK_EQ(Dio_PatternLoad(&Pattern), E_NOT_OK);
+	TEST_CHECK_EQ(Test_DetApi, DIO_PATTERN_LOAD_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_PORT_ID);
+	Pattern.NumOfSteps = 0U;
+	TEST_CHECK_EQ(Dio_PatternLoad(&Pattern), E_NOT_OK);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_CONFIG);
+	Pattern.Steps = NULL_PTR;
+	TEST_CHECK_EQ(Dio_PatternLoad(&Pattern), E_NOT_OK);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_POINTER);
+	TEST_CHECK_EQ(Test_DetCount, 4U);
+	TEST_CHECK_EQ(Dio_PatternIsBusy(), FALSE);
+}
+
+int main(void)
+{
+	TEST_RUN(Test_LoopTiming);
+	TEST_RUN(Test_SwitchAtPassEnd);
+	TEST_RUN(Test_Stop);
+	TEST_RUN(Test_NoDelay);
+	TEST_RUN(Test_LoadErrors);
+	return TEST_END();
+}
@@ -0,0 +1,153 @@
+/**
+ *@file       test_dio_shadow.c
+ *@brief      Host test of the Dio shadow output
+ *@details    Built with DIO_SHADOW_OUTPUT STD_ON: the writes are merged in RAM
+ *            and reach the simulated ports at Dio_ShadowCommit only, one counted
+ *            BSRR store per port with pending writes.
+ */
+#include "Dio.h"
+#include "test.h"
+
+#if (DIO_SHADOW_OUTPUT != STD_ON)
+#error "test_dio_shadow needs DIO_SHADOW_OUTPUT STD_ON"
+#endif
+
+extern const Dio_ChannelGroupType Dio_ChannelGroups[DIO_CONFIGURED_GROUPS];
+
+static void Test_ClearBsrr(void)
+{
+	uint32 Port;
+
+	for (Port = 0U; Port < NUM_OF_PORTS; Port++)
+	{
+		Dio_SimulatedPorts[Port].BSRR = 0U;
+		Dio_SimulatedBsrrStores[Port] = 0U;
+	}
+}
+
+static void Test_WritesWaitForCommit(void)
+{
+	Dio_ShadowCommit();
+	Test_ClearBsrr();
+	Dio_WriteChannel(A3, STD_HIGH);
+	Dio_WritePortMasked(PORTC, 0x2000U, 0x6000U);
+	Dio_WriteChannelGroup(&Dio_ChannelGroups[0], 0x81U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTB].BSRR, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTC].BSRR, 0U);
+
+	Dio_ShadowCommit();
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0x00000008U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTB].BSRR, 0x7E008100U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTC].BSRR, 0x40002000U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_LastWriteWins(void)
+{
+	Dio_ShadowCommit();
+	Test_ClearBsrr();
+	Dio_WriteChannel(B1, STD_HIGH);
+	Dio_WriteChannel(B2, STD_HIGH);
+	Dio_WriteChannel(B1, STD_LOW);
+	/* the port write replaces the pins it drives, B1 and B2 included */
+	Dio_WritePort(PORTA, 0x00F0U);
+	Dio_WriteChannel(A0, STD_HIGH);
+	Dio_WritePortMasked(PORTB, 0x0000U, 0x0004U);
+	Dio_ShadowCommit();
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0xFF0E00F1U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTB].BSRR, 0x00060000U);
+	/* a port without pending write is not written */
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTC].BSRR, 0U);
+}
+
+static void Test_CommitEmpties(void)
+{
+	Dio_WriteChannel(C0, STD_HIGH);
+	Dio_ShadowCommit();
+	Test_ClearBsrr();
+	Dio_ShadowCommit();
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTB].BSRR, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTC].BSRR, 0U);
+}
+
+/* A commit stores once to the BSRR of each port with pending writes and never to the others */
+static void Test_CommitStores(void)
+{
+	Dio_ShadowCommit();
+	Test_ClearBsrr();
+	Dio_WriteChannel(A1, STD_HIGH);
+	Dio_WriteChannel(A2, STD_LOW);
+	Dio_WritePortMasked(PORTA, 0x0100U, 0x0300U);
+	Dio_WriteChannelGroup(&Dio_ChannelGroups[0], 0x0FU);
+	Dio_WriteChannel(C15, STD_HIGH);
+	Dio_WritePort(PORTC, 0x1234U);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTA], 0U);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTB], 0U);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTC], 0U);
+	Dio_ShadowCommit();
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTA], 1U);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTB], 1U);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTC], 1U);
+
+	Test_ClearBsrr();
+	Dio_WriteChannel(B5, STD_HIGH);
+	Dio_WriteChannel(B6, STD_HIGH);
+	Dio_ShadowCommit();
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTA], 0U);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTB], 1U);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTC], 0U);
+}
+
+/* Dio_FlipChannel toggles the level the pin gets at the commit */
+static void Test_FlipShadowed(void)
+{
+	Dio_ShadowCommit();
+	Test_ClearBsrr();
+	Dio_SimulatedPorts[PORTA].ODR = 0x0008U;
+	/* no pending write: the output level is toggled */
+	TEST_CHECK_EQ(Dio_FlipChannel(A3), STD_LOW);
+	TEST_CHECK_EQ(Dio_FlipChannel(A4), STD_HIGH);
+	/* a pending write is toggled, not the output */
+	Dio_WriteChannel(A5, STD_HIGH);
+	TEST_CHECK_EQ(Dio_FlipChannel(A5), STD_LOW);
+	Dio_WriteChannel(A6, STD_LOW);
+	TEST_CHECK_EQ(Dio_FlipChannel(A6), STD_HIGH);
+	TEST_CHECK_EQ(Dio_FlipChannel(A6), STD_LOW);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTA], 0U);
+	Dio_ShadowCommit();
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0x00680010U);
+	TEST_CHECK_EQ(Dio_SimulatedBsrrStores[PORTA], 1U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_Errors(void)
+{
+	Dio_ShadowCommit();
+	Test_ClearBsrr();
+	Dio_WriteChannel((Dio_ChannelType) NUM_OF_PINS, STD_HIGH);
+	TEST_CHECK_EQ(Test_DetApi, DIO_WRITE_CHANNEL_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_WritePort((Dio_PortType) NUM_OF_PORTS, STD_PORTHIGH);
+	TEST_CHECK_EQ(Test_DetApi, DIO_WRITE_PORT_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_PORT_ID);
+	Dio_WritePortMasked((Dio_PortType) NUM_OF_PORTS, STD_PORTHIGH, STD_PORTHIGH);
+	TEST_CHECK_EQ(Test_DetApi, DIO_WRITE_PORT_MASKED_SID);
+	Dio_ShadowCommit();
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTA].BSRR, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTB].BSRR, 0U);
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTC].BSRR, 0U);
+	TEST_CHECK_EQ(Test_DetCount, 3U);
+}
+
+int main(void)
+{
+	TEST_RUN(Test_WritesWaitForCommit);
+	TEST_RUN(Test_LastWriteWins);
+	TEST_RUN(Test_CommitEmpties);
+	TEST_RUN(Test_CommitStores);
+	TEST_RUN(Test_FlipShadowed);
+	TEST_RUN(Test_Errors);
+	return TEST_END();
+}
@@ -0,0 +1,171 @@
+/**
+ *@file       test_dio_softpwm.c
+ *@brief      Host test of the Dio software PWM
+ *@details    Dio_SoftPwmTick drives C13 and C14 (Dio_LCfg.c), the BSRR store of
+ *            each tick is applied to the simulated ODR to count the high ticks.
+ */
+#include "Dio_SoftPwm.h"
+#include "test.h"
+
+#define TEST_C13	(0x2000U)
+#define TEST_C14	(0x4000U)
+
+/* Ticks since the start of the program, the PWM starts a period every DIO_SOFT_PWM_PERIOD */
+static uint32 Test_Ticks;
+
+/* Stores of the last tick into the BSRR of port C, 0 for none */
+static uint32 Test_LastBsrr;
+
+static void Test_Tick(void)
+{
+	uint32 Bsrr;
+
+	Dio_SimulatedPorts[PORTC].BSRR = 0U;
+	Dio_SoftPwmTick(NULL_PTR);
+	Bsrr = Dio_SimulatedPorts[PORTC].BSRR;
+	Dio_SimulatedPorts[PORTC].ODR = ((Dio_SimulatedPorts[PORTC].ODR & ~(Bsrr >> 16)) | Bsrr) & 0xFFFFU;
+	Test_LastBsrr = Bsrr;
+	Test_Ticks++;
+}
+
+/* Runs the ticks left in the current period */
+static void Test_EndPeriod(void)
+{
+	while ((Test_Ticks % DIO_SOFT_PWM_PERIOD) != 0U)
+	{
+		Test_Tick();
+	}
+}
+
+/* Runs one whole period and counts the high ticks of C13 and C14 */
+static void Test_Period(uint32 *HighC13, uint32 *HighC14)
+{
+	uint32 Tick;
+
+	*HighC13 = 0U;
+	*HighC14 = 0U;
+	for (Tick = 0U; Tick < DIO_SOFT_PWM_PERIOD; Tick++)
+	{
+		Test_Tick();
+		*HighC13 += ((Dio_SimulatedPorts[PORTC].ODR & TEST_C13) != 0U) ? 1U : 0U;
+		*HighC14 += ((Dio_SimulatedPorts[PORTC].ODR & TEST_C14) != 0U) ? 1U : 0U;
+	}
+}
+
+static void Test_Init(void)
+{
+	uint32 HighC13;
+	uint32 HighC14;
+
+	Dio_SimulatedPorts[PORTC].ODR = TEST_C13 | TEST_C14;
+	Dio_SoftPwmInit();
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+	Test_Tick();
+	/* both channels off from the first period */
+	TEST_CHECK_EQ(Test_LastBsrr, (TEST_C13 | TEST_C14) << 16);
+	Test_EndPeriod();
+	Test_Period(&HighC13, &HighC14);
+	TEST_CHECK_EQ(HighC13, 0U);
+	TEST_CHECK_EQ(HighC14, 0U);
+}
+
+static void Test_Duties(void)
+{
+	static const Dio_SoftPwmDutyType Duties[][2] = {
+		{ 64U, 200U }, { 1U, DIO_SOFT_PWM_PERIOD - 1U }, { DIO_SOFT_PWM_PERIOD, 0U }, { 0U, DIO_SOFT_PWM_PERIOD }
+	};
+	uint32 HighC13;
+	uint32 HighC14;
+	uint32 Setting;
+
+	for (Setting = 0U; Setting < (sizeof(Duties) / sizeof(Duties[0])); Setting++)
+	{
+		Dio_SoftPwmSetDuty(0U, Duties[Setting][0]);
+		Dio_SoftPwmSetDuty(1U, Duties[Setting][1]);
+		Test_EndPeriod();
+		Test_Period(&HighC13, &HighC14);
+		TEST_CHECK_EQ(HighC13, Duties[Setting][0]);
+		TEST_CHECK_EQ(HighC14, Duties[Setting][1]);
+	}
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+}
+
+static void Test_MergedEdge(void)
+{
+	uint32 Tick;
+	uint32 Stores = 0U;
+
+	Dio_SoftPwmSetDuty(0U, 100U);
+	Dio_SoftPwmSetDuty(1U, 100U);
+	Test_EndPeriod();
+	for (Tick = 0U; Tick < DIO_SOFT_PWM_PERIOD; Tick++)
+	{
+		Test_Tick();
+		if (Test_LastBsrr != 0U)
+		{
+			Stores++;
+			/* the start of the period and one store for both edges */
+			TEST_CHECK_EQ(Test_LastBsrr, (Tick == 0U) ? (TEST_C13 | TEST_C14) : ((TEST_C13 | TEST_C14) << 16));
+			TEST_CHECK((Tick == 0U) || (Tick == 100U));
+		}
+	}
+	TEST_CHECK_EQ(Stores, 2U);
+}
+
+static void Test_ChangeAtPeriodStart(void)
+{
+	uint32 HighC13;
+	uint32 HighC14;
+	uint32 Tick;
+
+	Dio_SoftPwmSetDuty(0U, 50U);
+	Dio_SoftPwmSetDuty(1U, 0U);
+	Test_EndPeriod();
+	/* a duty set in the middle of a period applies from the next one */
+	for (Tick = 0U; Tick < 20U; Tick++)
+	{
+		Test_Tick();
+	}
+	Dio_SoftPwmSetDuty(0U, 10U);
+	Dio_SoftPwmSetDuty(1U, 30U);
+	for (Tick = 20U; Tick < 60U; Tick++)
+	{
+		Test_Tick();
+		if (Tick < 50U)
+		{
+			TEST_CHECK_EQ(Dio_SimulatedPorts[PORTC].ODR & (TEST_C13 | TEST_C14), TEST_C13);
+		}
+	}
+	TEST_CHECK_EQ(Dio_SimulatedPorts[PORTC].ODR & (TEST_C13 | TEST_C14), 0U);
+	Test_EndPeriod();
+	Test_Period(&HighC13, &HighC14);
+	TEST_CHECK_EQ(HighC13, 10U);
+	TEST_CHECK_EQ(HighC14, 30U);
+}
+
+static void Test_Errors(void)
+{
+	uint32 HighC13;
+	uint32 HighC14;
+
+	Dio_SoftPwmSetDuty(0U, 40U);
+	Dio_SoftPwmSetDuty(1U, 80U);
+	Dio_SoftPwmSetDuty(DIO_SOFT_PWM_CONFIGURED_CHANNELS, 10U);
+	TEST_CHECK_EQ(Test_DetApi, DIO_SOFT_PWM_SET_DUTY_SID);
+	TEST_CHECK_EQ(Test_DetError, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	Test_EndPeriod();
+	Test_Period(&HighC13, &HighC14);
+	TEST_CHECK_EQ(HighC13, 40U);
+	TEST_CHECK_EQ(HighC14, 80U);
+}
+
+int main(void)
+{
+	TEST_RUN(Test_Init);
+	TEST_RUN(Test_Duties);
+	TEST_RUN(Test_MergedEdge);
+	TEST_RUN(Test_ChangeAtPeriodStart);
+	TEST_RUN(Test_Errors);
+	return TEST_END();
+}
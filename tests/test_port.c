@@ -0,0 +1,962 @@
+/**
+ *@file       test_port.c
+ *@brief      Host test of the Port driver
+ *@details    Port_Init on the simulated GPIO registers: the bits of every configured
+ *            pin are compared with a per pin model of the registers, written here
+ *            independently of the register images, and every other bit must keep
+ *            the content the registers had before the call. On TM4C the GPIOPCTL
+ *            field of every pin is also checked for every mode, after Port_Init
+ *            and after Port_WritePinMode. The register stores of Port_Init are counted
+ *            (PORT_REG_WRITE). Port_Verify is run on registers corrupted
+ *            one at a time, and the pin profiles are applied and left. Built with
+ *            Port_SetPinDirection / Port_SetPinMode, their Det checks are run too.
+ */
+#include "port.h"
+#include "port_private.h"
+#include "test.h"
+
+/* Register contents written before Port_Init, complementary so that every bit is seen at 0 and 1 */
+#define TEST_FILL			(0x5A5A5A5AUL)
+#define TEST_FILL_INVERTED	(0xA5A5A5A5UL)
+
+/* Bits of every register compared with the model of a pin */
+static uint32 Test_Owned[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+
+/* Configuration built from Port_Configuration, its images are computed by Port_Init */
+static Port_ConfigType Test_Config;
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+/* Pin id of pin 0 of each port (Port_PinId) */
+static const uint8 Test_PinIdBase[PORT_NUMBER_OF_PORTS] = { 0U, 8U, 16U, 24U, 32U, 38U };
+#define TEST_BACKEND_NAME	"TM4C"
+#define TEST_LEVELS_IMAGE	(PORT_IMAGE_DATA)
+#define TEST_OUTPUT			(PORT_PIN_OUT)
+#elif (PORT_BACKEND == PORT_BACKEND_STM32F103)
+static const uint8 Test_PinIdBase[PORT_NUMBER_OF_PORTS] = { 0U, 16U, 32U };
+#define TEST_BACKEND_NAME	"STM32F103"
+#define TEST_LEVELS_IMAGE	(PORT_IMAGE_ODR)
+#define TEST_OUTPUT			(PORT_PIN_OUT_2MHz)
+#endif
+
+static uint8 Test_PortOf(uint8 PinId)
+{
+	uint8 Port = PORT_NUMBER_OF_PORTS - 1U;
+
+	while (PinId < Test_PinIdBase[Port])
+	{
+		Port--;
+	}
+	return Port;
+}
+
+static void Test_FillPorts(uint32 Fill)
+{
+	uint32 Port;
+	uint32 Word;
+
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			Port_SimulatedPorts[Port][Word] = Fill;
+			Test_Owned[Port][Word] = 0U;
+		}
+	}
+}
+
+/* Compares the bits Mask of a register with Expected and marks them as checked */
+static void Test_CheckBits(uint8 Port, uint16 Offset, uint32 Mask, uint32 Expected)
+{
+	TEST_CHECK_EQ(PORT_REG(Port_SimulatedPorts[Port], Offset) & Mask, Expected & Mask);
+	Test_Owned[Port][Offset / 4U] |= Mask;
+}
+
+/* Changes the configuration of one pin of Test_Config */
+static void Test_SetPin(uint8 PinId, Port_PinModeType Mode, Port_PinDirectionType Direction,
+		Port_PinResistorType Resistor, Port_PinInitialValue Initial)
+{
+	Port_ChannelConfig *Pin = &Test_Config.arr[Port_GetConfigIndex(PinId)];
+
+	Pin->mode = Mode;
+	Pin->direction = Direction;
+	Pin->resistor = Resistor;
+	Pin->initial_value = Initial;
+	Pin->pin_enable = Enable;
+}
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+
+/* Model of the registers of one pin after Port_Init, Fill for the bits it must not write */
+static void Test_CheckPin(const Port_ChannelConfig *Pin, uint32 Fill)
+{
+	uint8 Port = Test_PortOf(Pin->pin_id);
+	uint8 Bit = Pin->pin_id - Test_PinIdBase[Port];
+	uint32 Mask = 1UL << Bit;
+	uint32 PctlMask = 0xFUL << (Bit * 4U);
+	uint32 Data = Fill;
+	uint32 Pur = Fill;
+	uint32 Pdr = Fill;
+
+	if (((Port == 3U) && (Bit == 7U)) || ((Port == 5U) && (Bit == 0U)))
+	{
+		/* PD7 and PF0: GPIOCR unlocked and the bit of the pin committed */
+		Test_CheckBits(Port, PORT_LOCK_REG_OFFSET, 0xFFFFFFFFUL, PORT_UNLOCK_VALUE);
+		Test_CheckBits(Port, PORT_COMMIT_REG_OFFSET, Mask, Mask);
+	}
+
+	if (Pin->pin_enable == Disable)
+	{
+		/* input with pull-up, no alternative function, GPIODATA / PDR / DEN / AMSEL kept */
+		Test_CheckBits(Port, PORT_DIR_REG_OFFSET, Mask, 0U);
+		Test_CheckBits(Port, PORT_PULL_UP_REG_OFFSET, Mask, Mask);
+		Test_CheckBits(Port, PORT_ALT_FUNC_REG_OFFSET, Mask, 0U);
+		Test_CheckBits(Port, PORT_CTL_REG_OFFSET, PctlMask, 0U);
+		Test_CheckBits(Port, PORT_DATA_REG_OFFSET, Mask, Fill);
+		Test_CheckBits(Port, PORT_PULL_DOWN_REG_OFFSET, Mask, Fill);
+		Test_CheckBits(Port, PORT_DIGITAL_ENABLE_REG_OFFSET, Mask, Fill);
+		Test_CheckBits(Port, PORT_ANALOG_MODE_SEL_REG_OFFSET, Mask, Fill);
+		return;
+	}
+
+	if (Pin->direction == PORT_PIN_OUT)
+	{
+		if (Pin->initial_value == INITIAL_HIGH)
+		{
+			Data = Mask;
+		}
+		else if (Pin->initial_value == INITIAL_LOW)
+		{
+			Data = 0U;
+		}
+	}
+	else if (Pin->resistor == PULL_UP)
+	{
+		Pur = Mask;
+	}
+	else if (Pin->resistor == PULL_DOWN)
+	{
+		Pdr = Mask;
+	}
+	else
+	{
+		Pur = 0U;
+		Pdr = 0U;
+	}
+
+	Test_CheckBits(Port, PORT_DIR_REG_OFFSET, Mask, (Pin->direction == PORT_PIN_OUT) ? Mask : 0U);
+	Test_CheckBits(Port, PORT_DATA_REG_OFFSET, Mask, Data);
+	Test_CheckBits(Port, PORT_PULL_UP_REG_OFFSET, Mask, Pur);
+	Test_CheckBits(Port, PORT_PULL_DOWN_REG_OFFSET, Mask, Pdr);
+	Test_CheckBits(Port, PORT_ALT_FUNC_REG_OFFSET, Mask, (Pin->mode != Gpio_Mode) ? Mask : 0U);
+	Test_CheckBits(Port, PORT_CTL_REG_OFFSET, PctlMask,
+			((Pin->mode == ADC_Mode) ? 0UL : (uint32) Pin->mode) << (Bit * 4U));
+	Test_CheckBits(Port, PORT_DIGITAL_ENABLE_REG_OFFSET, Mask, (Pin->mode == ADC_Mode) ? 0U : Mask);
+	Test_CheckBits(Port, PORT_ANALOG_MODE_SEL_REG_OFFSET, Mask, (Pin->mode == ADC_Mode) ? Mask : 0U);
+}
+
+/* Every branch of the pin model: outputs, pulls, alternative functions, analog and locked pins */
+static void Test_VariedConfig(void)
+{
+	Test_Config = Port_Configuration;
+	Test_Config.images = NULL_PTR;
+
+	Test_SetPin(PA0, Uart_Mode, PORT_PIN_IN, NONE, NO_INITIAL);
+	Test_SetPin(PA1, Uart_Mode, PORT_PIN_OUT, NONE, NO_INITIAL);
+	Test_SetPin(PB0, Gpio_Mode, PORT_PIN_OUT, NONE, INITIAL_HIGH);
+	Test_SetPin(PB1, Gpio_Mode, PORT_PIN_OUT, PULL_UP, INITIAL_LOW);
+	Test_SetPin(PB2, Gpio_Mode, PORT_PIN_IN, PULL_DOWN, NO_INITIAL);
+	Test_SetPin(PB3, Gpio_Mode, PORT_PIN_IN, NONE, INITIAL_HIGH);
+	Test_SetPin(PB4, M0PWM_Mode, PORT_PIN_OUT, NONE, INITIAL_LOW);
+	Test_SetPin(PC4, Uart1_PortC_Mode, PORT_PIN_IN, PULL_UP, NO_INITIAL);
+	Test_SetPin(PD0, SSI_PORTD_Mode, PORT_PIN_OUT, NONE, NO_INITIAL);
+	Test_SetPin(PD7, Gpio_Mode, PORT_PIN_OUT, NONE, INITIAL_HIGH);
+	Test_SetPin(PE0, ADC_Mode, PORT_PIN_IN, NONE, NO_INITIAL);
+	Test_SetPin(PE3, ADC_Mode, PORT_PIN_IN, PULL_DOWN, NO_INITIAL);
+	Test_SetPin(PF0, CAN0_PORTF_Mode, PORT_PIN_IN, PULL_UP, NO_INITIAL);
+	Test_SetPin(PF4, CAN_Mode, PORT_PIN_OUT, NONE, INITIAL_HIGH);
+}
+
+#elif (PORT_BACKEND == PORT_BACKEND_STM32F103)
+
+/* Model of the registers of one pin after Port_Init, Fill for the bits it must not write */
+static void Test_CheckPin(const Port_ChannelConfig *Pin, uint32 Fill)
+{
+	uint8 Port = Test_PortOf(Pin->pin_id);
+	uint8 Bit = Pin->pin_id - Test_PinIdBase[Port];
+	uint32 Mask = 1UL << Bit;
+	uint16 CrOffset = (Bit < 8U) ? PORT_CRL_REG_OFFSET : PORT_CRH_REG_OFFSET;
+	uint8 Shift = (Bit % 8U) * 4U;
+	uint32 Field = ((uint32) PULL_INPUT << 2) | (uint32) PORT_PIN_IN;
+	uint32 Odr = Mask;
+
+	if (Pin->pin_enable == Enable)
+	{
+		/* CNF[1:0] = mode, MODE[1:0] = direction */
+		Field = ((uint32) Pin->mode << 2) | (uint32) Pin->direction;
+		Odr = Fill;
+		if (Pin->direction != PORT_PIN_IN)
+		{
+			if (Pin->initial_value == INITIAL_HIGH)
+			{
+				Odr = Mask;
+			}
+			else if (Pin->initial_value == INITIAL_LOW)
+			{
+				Odr = 0U;
+			}
+		}
+		else if ((Pin->mode == PULL_INPUT) && (Pin->resistor != NONE))
+		{
+			Odr = (Pin->resistor == PULL_UP) ? Mask : 0U;
+		}
+	}
+
+	Test_CheckBits(Port, CrOffset, 0xFUL << Shift, Field << Shift);
+	Test_CheckBits(Port, PORT_ODR_REG_OFFSET, Mask, Odr);
+}
+
+/* Every branch of the pin model: output speeds and levels, alternate functions, analog and pulled inputs */
+static void Test_VariedConfig(void)
+{
+	Test_Config = Port_Configuration;
+	Test_Config.images = NULL_PTR;
+
+	Test_SetPin(PA1, GP_OPP, PORT_PIN_OUT_50MHz, NONE, INITIAL_HIGH);
+	Test_SetPin(PA2, GP_OOD, PORT_PIN_OUT_10MHz, PULL_UP, INITIAL_LOW);
+	Test_SetPin(PA3, AF_OPP, PORT_PIN_OUT_2MHz, NONE, NO_INITIAL);
+	Test_SetPin(PA4, ANALOG_INPUT, PORT_PIN_IN, NONE, NO_INITIAL);
+	Test_SetPin(PA5, FLOATING_INPUT, PORT_PIN_IN, PULL_UP, INITIAL_HIGH);
+	Test_SetPin(PA8, PULL_INPUT, PORT_PIN_IN, PULL_DOWN, NO_INITIAL);
+	Test_SetPin(PA12, PULL_INPUT, PORT_PIN_IN, NONE, NO_INITIAL);
+	Test_SetPin(PB8, AF_OOD, PORT_PIN_OUT_50MHz, NONE, INITIAL_LOW);
+	Test_SetPin(PB12, PULL_INPUT, PORT_PIN_IN, PULL_UP, NO_INITIAL);
+	Test_SetPin(PB15, GP_OPP, PORT_PIN_OUT_2MHz, NONE, INITIAL_LOW);
+	Test_SetPin(PC13, GP_OOD, PORT_PIN_OUT_10MHz, NONE, INITIAL_HIGH);
+}
+
+#endif /* PORT_BACKEND */
+
+/* Port_Init of Config on registers holding Fill, checked pin by pin then for the other bits */
+static void Test_CheckInit(const Port_ConfigType *Config, uint32 Fill)
+{
+	uint32 Port;
+	uint32 Word;
+	uint32 Pin;
+	uint32 Failures;
+
+	Test_FillPorts(Fill);
+	Port_Init(Config);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+
+	for (Pin = 0U; Pin < PORT_CONFIGURED_PINS; Pin++)
+	{
+		Failures = Test_Failures;
+		Test_CheckPin(&Config->arr[Pin], Fill);
+		if (Test_Failures != Failures)
+		{
+			printf("  pin id %u, registers filled with 0x%08lx\n", Config->arr[Pin].pin_id, (unsigned long) Fill);
+		}
+	}
+
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			Failures = Test_Failures;
+			TEST_CHECK_EQ(Port_SimulatedPorts[Port][Word] & ~Test_Owned[Port][Word], Fill & ~Test_Owned[Port][Word]);
+			if (Test_Failures != Failures)
+			{
+				printf("  port %lu, offset 0x%03lx\n", (unsigned long) Port, (unsigned long) (Word * 4U));
+			}
+		}
+	}
+}
+
+/* TRUE if the images of every port are the same */
+static boolean Test_SameImages(const Port_PortImageType *Actual, const Port_PortImageType *Expected)
+{
+	uint32 Port;
+	uint32 Reg;
+	boolean Same = TRUE;
+
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Reg = 0U; Reg < PORT_IMAGE_REGISTERS; Reg++)
+		{
+			if ((Actual[Port].reg[Reg].value != Expected[Port].reg[Reg].value)
+					|| (Actual[Port].reg[Reg].mask != Expected[Port].reg[Reg].mask))
+			{
+				printf("  port %lu, image register %lu: 0x%08lx / 0x%08lx, expected 0x%08lx / 0x%08lx\n",
+						(unsigned long) Port, (unsigned long) Reg,
+						(unsigned long) Actual[Port].reg[Reg].value, (unsigned long) Actual[Port].reg[Reg].mask,
+						(unsigned long) Expected[Port].reg[Reg].value, (unsigned long) Expected[Port].reg[Reg].mask);
+				Same = FALSE;
+			}
+		}
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+		if (Actual[Port].commit != Expected[Port].commit)
+		{
+			printf("  port %lu: commit 0x%02lx, expected 0x%02lx\n", (unsigned long) Port,
+					(unsigned long) Actual[Port].commit, (unsigned long) Expected[Port].commit);
+			Same = FALSE;
+		}
+#endif
+	}
+	return Same;
+}
+
+/* The generated images are the ones Port_BuildImages / Port_CompleteImages compute from the configuration */
+static void Test_GeneratedImages(void)
+{
+	Port_PortImageType Built[PORT_NUMBER_OF_PORTS];
+	uint32 Profile;
+	uint32 Port;
+	uint32 Reg;
+
+	Port_BuildImages(Port_Configuration.arr, Built);
+	TEST_CHECK(Test_SameImages(Port_Configuration.images, Built));
+
+	Port_CompleteImages(Port_Configuration.arr, Built);
+	TEST_CHECK(Test_SameImages(Port_ProfileImages[PORT_PROFILE_RUN], Built));
+
+	/* the other profiles come from tables the driver does not have: every one sets the same
+	 * fields as RUN, apart from the output levels, and writes no bit outside its mask */
+	for (Profile = 0U; Profile < PORT_NUMBER_OF_PROFILES; Profile++)
+	{
+		for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+		{
+			for (Reg = 0U; Reg < PORT_IMAGE_REGISTERS; Reg++)
+			{
+				const Port_RegImageType *Image = &Port_ProfileImages[Profile][Port].reg[Reg];
+
+				TEST_CHECK_EQ(Image->value & ~Image->mask, 0U);
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+				if (Reg != PORT_IMAGE_DATA)
+#else
+				if (Reg != PORT_IMAGE_ODR)
+#endif
+				{
+					TEST_CHECK_EQ(Image->mask, Built[Port].reg[Reg].mask);
+				}
+			}
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+			TEST_CHECK_EQ(Port_ProfileImages[Profile][Port].commit, Built[Port].commit);
+#endif
+		}
+	}
+}
+
+/* Flips the bits Flip of a register: Port_Verify must report the pins Expected and, with
+ * Repair, restore the registers; the bits it does not check are neither reported nor repaired */
+static void Test_Corrupt(uint8 Port, uint16 Offset, uint32 Flip, Port_PinMaskType Expected)
+{
+	static uint32 Before[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+	volatile uint32 *Reg = &PORT_REG(Port_SimulatedPorts[Port], Offset);
+	uint32 Saved = *Reg;
+	uint32 Index;
+	uint32 Word;
+
+	for (Index = 0U; Index < PORT_NUMBER_OF_PORTS; Index++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			Before[Index][Word] = Port_SimulatedPorts[Index][Word];
+		}
+	}
+
+	*Reg = Saved ^ Flip;
+	TEST_CHECK_EQ(Port_Verify(FALSE), Expected);
+	TEST_CHECK_EQ(*Reg, Saved ^ Flip);
+	TEST_CHECK_EQ(Port_Verify(TRUE), Expected);
+	if (Expected == 0U)
+	{
+		TEST_CHECK_EQ(*Reg, Saved ^ Flip);
+		*Reg = Saved;
+	}
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+
+	for (Index = 0U; Index < PORT_NUMBER_OF_PORTS; Index++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			TEST_CHECK_EQ(Port_SimulatedPorts[Index][Word], Before[Index][Word]);
+		}
+	}
+}
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+static void Test_Verify(void)
+{
+	/* PF1 with a changeable direction, PF4 with a changeable mode */
+	Test_Config = Port_Configuration;
+	Test_Config.images = NULL_PTR;
+	Test_Config.arr[Port_GetConfigIndex(PF1)].d_ch = STD_ON;
+	Test_Config.arr[Port_GetConfigIndex(PF4)].m_ch = STD_ON;
+	Test_FillPorts(TEST_FILL);
+	Port_Init(&Test_Config);
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+
+	Test_Corrupt(PORTA, PORT_PULL_UP_REG_OFFSET, 0x01U, PORT_PIN_MASK(PA0));
+	Test_Corrupt(PORTB, PORT_DIR_REG_OFFSET, 0x05U, PORT_PIN_MASK(PB0) | PORT_PIN_MASK(PB2));
+	Test_Corrupt(PORTC, PORT_CTL_REG_OFFSET, 0x5UL << 20, PORT_PIN_MASK(PC5));
+	Test_Corrupt(PORTD, PORT_DIR_REG_OFFSET, 0x80U, PORT_PIN_MASK(PD7));
+	Test_Corrupt(PORTE, PORT_ALT_FUNC_REG_OFFSET, 0x01U, PORT_PIN_MASK(PE0));
+	Test_Corrupt(PORTF, PORT_DIGITAL_ENABLE_REG_OFFSET, 0x02U, PORT_PIN_MASK(PF1));
+	Test_Corrupt(PORTF, PORT_ANALOG_MODE_SEL_REG_OFFSET, 0x02U, PORT_PIN_MASK(PF1));
+	Test_Corrupt(PORTF, PORT_PULL_UP_REG_OFFSET, 0x10U, PORT_PIN_MASK(PF4));
+
+	/* output levels, bits no configured pin writes, fields changeable at run time */
+	Test_Corrupt(PORTF, PORT_DATA_REG_OFFSET, 0xFFU, 0U);
+	Test_Corrupt(PORTC, PORT_CTL_REG_OFFSET, 0xFFFFU, 0U);
+	Test_Corrupt(PORTA, PORT_PULL_DOWN_REG_OFFSET, 0x01U, 0U);
+	Test_Corrupt(PORTF, PORT_DIR_REG_OFFSET, 0x02U, 0U);
+	Test_Corrupt(PORTF, PORT_ALT_FUNC_REG_OFFSET, 0x10U, 0U);
+	Test_Corrupt(PORTF, PORT_CTL_REG_OFFSET, 0xFUL << 16, 0U);
+	Test_Corrupt(PORTF, PORT_DIGITAL_ENABLE_REG_OFFSET, 0x10U, 0U);
+}
+#elif (PORT_BACKEND == PORT_BACKEND_STM32F103)
+static void Test_Verify(void)
+{
+	/* PA9 / PA10 have a changeable direction and mode in the generated configuration */
+	Test_FillPorts(TEST_FILL);
+	Port_Init(&Port_Configuration);
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+
+	Test_Corrupt(PORTA, PORT_CRL_REG_OFFSET, 0x4U, PORT_PIN_MASK(PA0));
+	Test_Corrupt(PORTA, PORT_ODR_REG_OFFSET, 0x1U, PORT_PIN_MASK(PA0));
+	Test_Corrupt(PORTA, PORT_CRL_REG_OFFSET, 0xFF0U, PORT_PIN_MASK(PA1) | PORT_PIN_MASK(PA2));
+	Test_Corrupt(PORTB, PORT_CRL_REG_OFFSET, 0xF0U, PORT_PIN_MASK(PB1));
+	Test_Corrupt(PORTB, PORT_CRH_REG_OFFSET, 0x8UL << 28, PORT_PIN_MASK(PB15));
+	Test_Corrupt(PORTC, PORT_CRH_REG_OFFSET, 0x1UL << 20, PORT_PIN_MASK(PC13));
+
+	/* output levels, registers and fields no configured pin writes, fields changeable at run time */
+	Test_Corrupt(PORTC, PORT_ODR_REG_OFFSET, 0x1UL << 13, 0U);
+	Test_Corrupt(PORTA, PORT_IDR_REG_OFFSET, 0xFFFFU, 0U);
+	Test_Corrupt(PORTA, PORT_CRH_REG_OFFSET, 0xFFUL << 20, 0U);
+	Test_Corrupt(PORTA, PORT_CRH_REG_OFFSET, 0x3UL << 4, 0U);
+	Test_Corrupt(PORTA, PORT_CRH_REG_OFFSET, 0x3UL << 10, 0U);
+	Test_Corrupt(PORTA, PORT_ODR_REG_OFFSET, 0x1UL << 9, 0U);
+}
+#endif
+
+/* Runs before any Port_Init: the driver state cannot be reset */
+static void Test_Uninit(void)
+{
+	uint32 Port;
+	uint32 Word;
+
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetModule, PORT_MODULE_ID);
+	TEST_CHECK_EQ(Test_DetApi, PORT_VERIFY_SID);
+	TEST_CHECK_EQ(Test_DetError, PORT_E_UNINIT);
+
+	Test_DetClear();
+	Test_FillPorts(TEST_FILL);
+	Port_Init(NULL_PTR);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetApi, PORT_INIT_SID);
+	TEST_CHECK_EQ(Test_DetError, PORT_E_PARAM_CONFIG);
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			TEST_CHECK_EQ(Port_SimulatedPorts[Port][Word], TEST_FILL);
+		}
+	}
+
+	/* a rejected configuration leaves the driver uninitialized */
+	Test_DetClear();
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+	TEST_CHECK_EQ(Test_DetApi, PORT_VERIFY_SID);
+	TEST_CHECK_EQ(Test_DetError, PORT_E_UNINIT);
+
+	/* the services writing pins stop at the report, without a configuration to read */
+	Test_DetClear();
+	Port_RefreshPortDirection();
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetApi, PORT_REFRESH_PORT_DIRECTION_SID);
+	TEST_CHECK_EQ(Test_DetError, PORT_E_UNINIT);
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+	Test_DetClear();
+	Port_SetPinDirection(Port_Configuration.arr[0].pin_id, TEST_OUTPUT);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetApi, PORT_SET_PIN_DIRECTION_SID);
+	TEST_CHECK_EQ(Test_DetError, PORT_E_UNINIT);
+#endif
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+	Test_DetClear();
+	Port_SetPinMode(Port_Configuration.arr[0].pin_id, Gpio_Mode);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetApi, PORT_SET_PIN_MODE_SID);
+	TEST_CHECK_EQ(Test_DetError, PORT_E_UNINIT);
+#endif
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			TEST_CHECK_EQ(Port_SimulatedPorts[Port][Word], TEST_FILL);
+		}
+	}
+}
+
+static void Test_InitGenerated(void)
+{
+	Test_CheckInit(&Port_Configuration, TEST_FILL);
+	Test_CheckInit(&Port_Configuration, TEST_FILL_INVERTED);
+}
+
+static void Test_InitBuilt(void)
+{
+	Test_VariedConfig();
+	Test_CheckInit(&Test_Config, TEST_FILL);
+	Test_CheckInit(&Test_Config, TEST_FILL_INVERTED);
+}
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+/* Stores of the per pin Port_Init the register images replaced: GPIOLOCK and GPIOCR for PD7 and
+ * PF0, GPIODIR, GPIOPUR and GPIOAFSEL for a disabled pin, GPIODIR, the level or the pull
+ * registers, GPIOAFSEL, GPIOAMSEL and GPIODEN for an enabled one */
+static uint32 Test_PerPinStores(const Port_ConfigType *Config)
+{
+	const Port_ChannelConfig *Pin;
+	uint32 Stores = 0U;
+	uint32 Index;
+
+	for (Index = 0U; Index < PORT_CONFIGURED_PINS; Index++)
+	{
+		Pin = &Config->arr[Index];
+		if ((Pin->pin_id == PD7) || (Pin->pin_id == PF0))
+		{
+			Stores += 2U;
+		}
+		if (Pin->pin_enable == Disable)
+		{
+			Stores += 3U;
+		}
+		else
+		{
+			Stores += 4U;
+			if (Pin->direction == PORT_PIN_OUT)
+			{
+				Stores += (Pin->initial_value != NO_INITIAL) ? 1U : 0U;
+			}
+			else
+			{
+				Stores += (Pin->resistor == NONE) ? 2U : 1U;
+			}
+		}
+	}
+	return Stores;
+}
+#endif
+
+/* Port_Init stores every register at most once: the registers with configured bits, and
+ * GPIOLOCK / GPIOCR on the TM4C ports with locked pins */
+static void Test_InitStores(void)
+{
+	const Port_ConfigType *Configs[2] = { &Port_Configuration, &Test_Config };
+	Port_PortImageType Images[PORT_NUMBER_OF_PORTS];
+	uint32 Config;
+	uint32 Port;
+	uint32 Word;
+	uint32 Reg;
+	uint32 Stores;
+	uint32 Expected;
+
+	Test_VariedConfig();
+	for (Config = 0U; Config < 2U; Config++)
+	{
+		for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+		{
+			for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+			{
+				Port_SimulatedStores[Port][Word] = 0U;
+			}
+		}
+		Port_Init(Configs[Config]);
+
+		Stores = 0U;
+		for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+		{
+			for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+			{
+				TEST_CHECK(Port_SimulatedStores[Port][Word] <= 1U);
+				Stores += Port_SimulatedStores[Port][Word];
+			}
+		}
+
+		Expected = 0U;
+		Port_BuildImages(Configs[Config]->arr, Images);
+		for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+		{
+			for (Reg = 0U; Reg < PORT_IMAGE_REGISTERS; Reg++)
+			{
+				Expected += (Images[Port].reg[Reg].mask != 0U) ? 1U : 0U;
+			}
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+			Expected += (Images[Port].commit != 0U) ? 2U : 0U;
+#endif
+		}
+		TEST_CHECK_EQ(Stores, Expected);
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+		TEST_CHECK(Stores < Test_PerPinStores(Configs[Config]));
+		printf("  Port_Init: %lu register stores, %lu with the per pin writes\n",
+				(unsigned long) Stores, (unsigned long) Test_PerPinStores(Configs[Config]));
+#endif
+	}
+}
+
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+/* Every pin enabled, each round shifts the modes so that every pin gets every GPIOPCTL value */
+static void Test_PctlModes(void)
+{
+	uint32 Round;
+	uint32 Pin;
+	Port_ChannelConfig *Config;
+
+	for (Round = 0U; Round <= PORT_MAX_MODE; Round++)
+	{
+		Test_Config = Port_Configuration;
+		Test_Config.images = NULL_PTR;
+		for (Pin = 0U; Pin < PORT_CONFIGURED_PINS; Pin++)
+		{
+			Config = &Test_Config.arr[Pin];
+			Config->mode = (Port_PinModeType) ((Pin + Round) % (PORT_MAX_MODE + 1U));
+			Config->direction = (Config->mode == ADC_Mode) ? PORT_PIN_IN : PORT_PIN_OUT;
+			Config->resistor = NONE;
+			Config->pin_enable = Enable;
+		}
+		Test_CheckInit(&Test_Config, TEST_FILL);
+		Test_CheckInit(&Test_Config, TEST_FILL_INVERTED);
+	}
+}
+
+/* Port_WritePinMode (Port_SetPinMode) changes the GPIOPCTL field and the mode bits of its pin only */
+static void Test_PinMode(void)
+{
+	static uint32 Before[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+	uint32 Pin;
+	uint32 Mode;
+	uint32 Port;
+	uint32 Word;
+	uint8 PinPort;
+	uint8 Bit;
+
+	Test_CheckInit(&Port_Configuration, TEST_FILL);
+	for (Pin = 0U; Pin < PORT_CONFIGURED_PINS; Pin++)
+	{
+		PinPort = Test_PortOf(Port_Configuration.arr[Pin].pin_id);
+		Bit = Port_Configuration.arr[Pin].pin_id - Test_PinIdBase[PinPort];
+		for (Mode = 0U; Mode <= PORT_MAX_MODE; Mode++)
+		{
+			for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+			{
+				for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+				{
+					Before[Port][Word] = Port_SimulatedPorts[Port][Word];
+					Test_Owned[Port][Word] = 0U;
+				}
+			}
+
+			Port_WritePinMode(Port_Configuration.arr[Pin].pin_id, (Port_PinModeType) Mode);
+			Test_CheckBits(PinPort, PORT_CTL_REG_OFFSET, 0xFUL << (Bit * 4U),
+					((Mode == ADC_Mode) ? 0UL : Mode) << (Bit * 4U));
+			Test_CheckBits(PinPort, PORT_ALT_FUNC_REG_OFFSET, 1UL << Bit, (Mode != Gpio_Mode) ? (1UL << Bit) : 0U);
+			Test_CheckBits(PinPort, PORT_DIGITAL_ENABLE_REG_OFFSET, 1UL << Bit, (Mode == ADC_Mode) ? 0U : (1UL << Bit));
+			Test_CheckBits(PinPort, PORT_ANALOG_MODE_SEL_REG_OFFSET, 1UL << Bit, (Mode == ADC_Mode) ? (1UL << Bit) : 0U);
+			/* PD7 and PF0 are unlocked first */
+			Test_Owned[PinPort][PORT_LOCK_REG_OFFSET / 4U] = 0xFFFFFFFFUL;
+			Test_Owned[PinPort][PORT_COMMIT_REG_OFFSET / 4U] = 1UL << Bit;
+
+			for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+			{
+				for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+				{
+					TEST_CHECK_EQ(Port_SimulatedPorts[Port][Word] & ~Test_Owned[Port][Word],
+							Before[Port][Word] & ~Test_Owned[Port][Word]);
+				}
+			}
+		}
+	}
+}
+#endif
+
+/* Every register holds the bits its image writes */
+static void Test_CheckImages(const Port_PortImageType *Images)
+{
+	uint32 Port;
+	uint32 Reg;
+
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Reg = 0U; Reg < PORT_IMAGE_REGISTERS; Reg++)
+		{
+			TEST_CHECK_EQ(PORT_REG(Port_SimulatedPorts[Port], Port_ImageRegOffset[Reg]) & Images[Port].reg[Reg].mask,
+					Images[Port].reg[Reg].value);
+		}
+	}
+}
+
+/* Runs before any Port_Init: RUN is the generated configuration */
+static void Test_ProfileBeforeInit(void)
+{
+	Test_FillPorts(0U);
+	Port_ApplyProfile(PORT_PROFILE_RUN);
+	Test_CheckImages(Port_ProfileImages[PORT_PROFILE_RUN]);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+
+	/* applying a profile does not initialize the driver */
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+	TEST_CHECK_EQ(Test_DetError, PORT_E_UNINIT);
+}
+
+/* Every register holds Expected; with LevelsOf the output levels LevelsOf does not write are not compared */
+static void Test_ComparePorts(uint32 (*Expected)[PORT_SIMULATED_PORT_WORDS], const Port_PortImageType *LevelsOf)
+{
+	uint32 Port;
+	uint32 Word;
+	uint32 Compared;
+
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			Compared = 0xFFFFFFFFUL;
+			if ((LevelsOf != NULL_PTR) && (Word == (Port_ImageRegOffset[TEST_LEVELS_IMAGE] / 4U)))
+			{
+				Compared = LevelsOf[Port].reg[TEST_LEVELS_IMAGE].mask;
+			}
+			TEST_CHECK_EQ(Port_SimulatedPorts[Port][Word] & Compared, Expected[Port][Word] & Compared);
+		}
+	}
+}
+
+/* SAFE and SLEEP then RUN give back the registers of Port_Init, apart from the levels
+ * of the outputs without an initial value */
+static void Test_Profiles(void)
+{
+	static uint32 AfterInit[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+	Port_PortImageType Images[PORT_NUMBER_OF_PORTS];
+	uint32 Port;
+	uint32 Word;
+
+	Test_VariedConfig();
+	Test_FillPorts(0U);
+	Port_Init(&Test_Config);
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			AfterInit[Port][Word] = Port_SimulatedPorts[Port][Word];
+		}
+	}
+
+	Port_ApplyProfile(PORT_NUMBER_OF_PROFILES);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetApi, PORT_APPLY_PROFILE_SID);
+	TEST_CHECK_EQ(Test_DetError, PORT_E_PARAM_PROFILE);
+	Test_ComparePorts(AfterInit, NULL_PTR);
+	Test_DetClear();
+
+	Port_ApplyProfile(PORT_PROFILE_SAFE);
+	Test_CheckImages(Port_ProfileImages[PORT_PROFILE_SAFE]);
+	/* Port_Verify checks the registers against the profile, not against Port_Init */
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+	Port_WriteImages(Port_ProfileImages[PORT_PROFILE_RUN]);
+	TEST_CHECK(Port_Verify(TRUE) != 0U);
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+
+	Port_ApplyProfile(PORT_PROFILE_SLEEP);
+	Test_CheckImages(Port_ProfileImages[PORT_PROFILE_SLEEP]);
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+
+	/* RUN sets the levels Port_Init sets, the others stay as the profiles left them */
+	Port_ApplyProfile(PORT_PROFILE_RUN);
+	TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+	Port_BuildImages(Test_Config.arr, Images);
+	Test_ComparePorts(AfterInit, Images);
+}
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON) || (PORT_SET_PIN_MODE_API == STD_ON)
+/* Register file before the service under test */
+static uint32 Test_Before[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+
+static void Test_SavePorts(void)
+{
+	uint32 Port;
+	uint32 Word;
+
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			Test_Before[Port][Word] = Port_SimulatedPorts[Port][Word];
+		}
+	}
+}
+
+/* A rejected call reports Error for Api once and leaves every register as Test_SavePorts saw it */
+static void Test_CheckRejected(uint8 Api, uint8 Error)
+{
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetApi, Api);
+	TEST_CHECK_EQ(Test_DetError, Error);
+	Test_ComparePorts(Test_Before, NULL_PTR);
+	Test_DetClear();
+}
+
+/* A pin id below PORT_PIN_ID_COUNT without an entry in the configuration */
+static uint8 Test_UnconfiguredPin(void)
+{
+	uint8 PinId = 0U;
+
+	while (Port_PinIndex[PinId] != PORT_PIN_NOT_CONFIGURED)
+	{
+		PinId++;
+	}
+	return PinId;
+}
+
+/* Port_SetPinDirection / Port_SetPinMode on the pins the Det checks reject, then on a changeable
+ * pin: the registers end as Port_WritePinDirection / Port_WritePinMode leave them */
+static void Test_Setters(void)
+{
+	static uint32 Accepted[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+	const uint8 Changeable = Port_Configuration.arr[0].pin_id;
+	const uint8 Fixed = Port_Configuration.arr[1].pin_id;
+	uint32 Port;
+	uint32 Word;
+
+	TEST_CHECK(Test_UnconfiguredPin() < PORT_PIN_ID_COUNT);
+	Test_Config = Port_Configuration;
+	Test_Config.images = NULL_PTR;
+	Test_Config.arr[0].d_ch = STD_ON;
+	Test_Config.arr[0].m_ch = STD_ON;
+	Test_Config.arr[1].d_ch = STD_OFF;
+	Test_Config.arr[1].m_ch = STD_OFF;
+	Test_FillPorts(TEST_FILL);
+	Port_Init(&Test_Config);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+	Test_SavePorts();
+	Port_SetPinDirection(PORT_PIN_ID_COUNT, TEST_OUTPUT);
+	Test_CheckRejected(PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
+	Port_SetPinDirection(Test_UnconfiguredPin(), TEST_OUTPUT);
+	Test_CheckRejected(PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
+	Port_SetPinDirection(Fixed, TEST_OUTPUT);
+	Test_CheckRejected(PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+
+	Port_SetPinDirection(Changeable, TEST_OUTPUT);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			Accepted[Port][Word] = Port_SimulatedPorts[Port][Word];
+			Port_SimulatedPorts[Port][Word] = Test_Before[Port][Word];
+		}
+	}
+	Port_WritePinDirection(Changeable, TEST_OUTPUT);
+	Test_ComparePorts(Accepted, NULL_PTR);
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+	Test_SavePorts();
+	Port_SetPinMode(PORT_PIN_ID_COUNT, Gpio_Mode);
+	Test_CheckRejected(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+	Port_SetPinMode(Test_UnconfiguredPin(), Gpio_Mode);
+	Test_CheckRejected(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+	Port_SetPinMode(Fixed, Gpio_Mode);
+	Test_CheckRejected(PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+	Port_SetPinMode(Changeable, (Port_PinModeType) (PORT_MAX_MODE + 1U));
+	Test_CheckRejected(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+
+	Port_SetPinMode(Changeable, PORT_MAX_MODE);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			Accepted[Port][Word] = Port_SimulatedPorts[Port][Word];
+			Port_SimulatedPorts[Port][Word] = Test_Before[Port][Word];
+		}
+	}
+	Port_WritePinMode(Changeable, PORT_MAX_MODE);
+	Test_ComparePorts(Accepted, NULL_PTR);
+#endif
+}
+#endif
+
+/* Port_RefreshPortDirection keeps the directions of SAFE and SLEEP, and refreshes RUN again */
+static void Test_ProfileRefresh(void)
+{
+	static uint32 Expected[PORT_NUMBER_OF_PORTS][PORT_SIMULATED_PORT_WORDS];
+	static const Port_ProfileType Profiles[] = { PORT_PROFILE_SAFE, PORT_PROFILE_SLEEP, PORT_PROFILE_RUN };
+	uint32 Profile;
+	uint32 Port;
+	uint32 Word;
+	boolean Written = FALSE;
+
+	Test_VariedConfig();
+	Test_FillPorts(0U);
+	Port_Init(&Test_Config);
+	for (Profile = 0U; Profile < (sizeof(Profiles) / sizeof(Profiles[0])); Profile++)
+	{
+		Port_ApplyProfile(Profiles[Profile]);
+		for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+		{
+			for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+			{
+				Expected[Port][Word] = Port_SimulatedPorts[Port][Word];
+			}
+		}
+		Port_RefreshPortDirection();
+		Test_ComparePorts(Expected, NULL_PTR);
+		TEST_CHECK_EQ(Port_Verify(FALSE), 0U);
+	}
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+
+	/* Port_Init returns to RUN: on cleared registers the refresh sets the outputs again */
+	Port_ApplyProfile(PORT_PROFILE_SAFE);
+	Port_Init(&Test_Config);
+	Test_FillPorts(0U);
+	Port_RefreshPortDirection();
+	for (Port = 0U; Port < PORT_NUMBER_OF_PORTS; Port++)
+	{
+		for (Word = 0U; Word < PORT_SIMULATED_PORT_WORDS; Word++)
+		{
+			if (Port_SimulatedPorts[Port][Word] != 0U)
+			{
+				Written = TRUE;
+			}
+		}
+	}
+	TEST_CHECK(Written == TRUE);
+}
+
+int main(void)
+{
+	printf("%s: %s backend\n", __FILE__, TEST_BACKEND_NAME);
+	TEST_RUN(Test_Uninit);
+	TEST_RUN(Test_ProfileBeforeInit);
+	TEST_RUN(Test_GeneratedImages);
+	TEST_RUN(Test_InitGenerated);
+	TEST_RUN(Test_InitBuilt);
+	TEST_RUN(Test_InitStores);
+	TEST_RUN(Test_Verify);
+	TEST_RUN(Test_Profiles);
+	TEST_RUN(Test_ProfileRefresh);
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON) || (PORT_SET_PIN_MODE_API == STD_ON)
+	TEST_RUN(Test_Setters);
+#endif
+#if (PORT_BACKEND == PORT_BACKEND_TM4C)
+	TEST_RUN(Test_PctlModes);
+	TEST_RUN(Test_PinMode);
+#endif
+	return TEST_END();
+}
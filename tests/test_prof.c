@@ -0,0 +1,113 @@
+/**
+ *@file       test_prof.c
+ *@brief      Host test of the Prof module
+ *@details    Count / min / max / mean accumulated by Prof_Record, the Det reports of
+ *            Prof_Record and Prof_GetStats, and the text Prof_Dump transmits.
+ */
+#include <string.h>
+#include "Prof.h"
+#include "test.h"
+
+static void Test_Record(void)
+{
+	Prof_StatsType Stats;
+
+	Prof_Init();
+	Prof_Record(PROF_PROBE_UART_TRANSMIT, 5U);
+	Prof_Record(PROF_PROBE_UART_TRANSMIT, 3U);
+	Prof_Record(PROF_PROBE_UART_TRANSMIT, 10U);
+	Prof_GetStats(PROF_PROBE_UART_TRANSMIT, &Stats);
+	TEST_CHECK_EQ(Stats.Count, 3U);
+	TEST_CHECK_EQ(Stats.Min, 3U);
+	TEST_CHECK_EQ(Stats.Max, 10U);
+	TEST_CHECK_EQ(Stats.Total, 18U);
+
+	/* the total does not wrap at 32 bits */
+	Prof_Record(PROF_PROBE_DIO_WRITE, 0xFFFFFFFFUL);
+	Prof_Record(PROF_PROBE_DIO_WRITE, 0xFFFFFFFFUL);
+	Prof_GetStats(PROF_PROBE_DIO_WRITE, &Stats);
+	TEST_CHECK_EQ(Stats.Count, 2U);
+	TEST_CHECK_EQ(Stats.Min, 0xFFFFFFFFUL);
+	TEST_CHECK(Stats.Total == 0x1FFFFFFFEULL);
+
+	/* a probe that never ran */
+	Prof_GetStats(PROF_PROBE_PORT_INIT, &Stats);
+	TEST_CHECK_EQ(Stats.Count, 0U);
+	TEST_CHECK_EQ(Test_DetCount, 0U);
+
+	Prof_Reset();
+	Prof_GetStats(PROF_PROBE_UART_TRANSMIT, &Stats);
+	TEST_CHECK_EQ(Stats.Count, 0U);
+	TEST_CHECK_EQ(Stats.Max, 0U);
+}
+
+static void Test_Probes(void)
+{
+	Prof_StatsType Stats;
+	volatile uint32 Spin;
+
+	Prof_Init();
+	{
+		PROF_START(PROF_PROBE_PORT_INIT);
+		for (Spin = 0U; Spin < 1000U; Spin++)
+		{
+		}
+		PROF_STOP(PROF_PROBE_PORT_INIT);
+	}
+	Prof_GetStats(PROF_PROBE_PORT_INIT, &Stats);
+	TEST_CHECK_EQ(Stats.Count, 1U);
+	TEST_CHECK(Stats.Min > 0U);
+	TEST_CHECK_EQ(Stats.Min, Stats.Max);
+}
+
+static void Test_Errors(void)
+{
+	Prof_StatsType Stats;
+
+	Prof_Init();
+	Prof_Record(PROF_NUM_OF_PROBES, 1U);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetModule, PROF_MODULE_ID);
+	TEST_CHECK_EQ(Test_DetApi, PROF_RECORD_SID);
+	TEST_CHECK_EQ(Test_DetError, PROF_E_PARAM_PROBE);
+
+	Prof_GetStats(PROF_NUM_OF_PROBES, &Stats);
+	TEST_CHECK_EQ(Test_DetCount, 2U);
+	TEST_CHECK_EQ(Test_DetApi, PROF_GET_STATS_SID);
+	TEST_CHECK_EQ(Test_DetError, PROF_E_PARAM_PROBE);
+
+	Prof_GetStats(PROF_PROBE_PORT_INIT, NULL_PTR);
+	TEST_CHECK_EQ(Test_DetCount, 3U);
+	TEST_CHECK_EQ(Test_DetApi, PROF_GET_STATS_SID);
+	TEST_CHECK_EQ(Test_DetError, PROF_E_PARAM_POINTER);
+}
+
+static void Test_Dump(void)
+{
+	Prof_Init();
+	Test_UartClear();
+	Prof_Dump(UART1);
+	TEST_CHECK_EQ(Test_UartLength, 0U);
+
+	Prof_Record(PROF_PROBE_UART_TRANSMIT, 5U);
+	Prof_Record(PROF_PROBE_UART_TRANSMIT, 3U);
+	Prof_Record(PROF_PROBE_UART_TRANSMIT, 11U);
+	Prof_Record(PROF_PROBE_SYSTICK_CALLBACK, 4294967295UL);
+	Prof_Dump(UART1);
+	TEST_CHECK(strcmp(Test_UartBuffer,
+			"P1 n=3 min=3 max=11 mean=6\r\n"
+			"P3 n=1 min=4294967295 max=4294967295 mean=4294967295\r\n") == 0);
+	if (Test_Failures != 0U)
+	{
+		printf("  dump: %s", Test_UartBuffer);
+	}
+}
+
+int main(void)
+{
+	TEST_RUN(Test_Record);
+	TEST_RUN(Test_Probes);
+	TEST_RUN(Test_Errors);
+	TEST_RUN(Test_Dump);
+	return TEST_END();
+}
@@ -0,0 +1,448 @@
+/**
+ *@file       test_systick.c
+ *@brief      Host test of the Systick driver
+ *@details    Timer start / stop and the mode switches of a running timer on the
+ *            simulated SysTick registers, SysTick_Handler is called as the interrupt.
+ */
+#include "Systick.h"
+#include "test.h"
+
+/* Interrupt handler of Systick.c, called by the tests as the SysTick exception */
+void SysTick_Handler(void);
+
+#define TEST_SYSTICK_ENABLE		(1UL << SYSTICK_CTRL_ENABLE)
+#define TEST_SYSTICK_TICKINT	(1UL << SYSTICK_CTRL_TICKINT)
+
+/* Notification of Systick_Configuration (Systick_LCfg.c) */
+static uint32 Test_FuncCalls;
+void FUNC(void* Context)
+{
+	(void) Context;
+	Test_FuncCalls++;
+}
+
+static uint32 Test_Calls;
+static void* Test_LastContext;
+static void Test_Callback(void* Context)
+{
+	Test_Calls++;
+	Test_LastContext = Context;
+}
+
+/* One-shot callback starting the next one-shot timer */
+static void Test_Restart(void* Context)
+{
+	Test_Calls++;
+	Systick_StartTimerWithCallback(2, Test_Restart, Context);
+}
+
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+/* Counter value at the end of Test_Elapse, the callback duration of the simulated interrupt */
+static uint32 Test_ExitValue;
+static void Test_Elapse(void* Context)
+{
+	(void) Context;
+	Test_Calls++;
+	Systick_SimulatedSystick.VAL = Test_ExitValue;
+}
+
+/* Callback restarting the timer with another period */
+static void Test_ElapseRestart(void* Context)
+{
+	Test_Calls++;
+	Systick_StartTimerWithCallback(2, Test_ElapseRestart, Context);
+	Systick_SimulatedSystick.VAL = 1990U;
+}
+#endif
+
+static void Test_Setup(Systick_ModeType Mode)
+{
+	Systick_ConfigType Config = { SYSTICK_AHB_8, SYSTICK_PERIODIC_INTERVAL, Test_Callback, NULL_PTR };
+
+	Config.SysTick_ChannelMode = Mode;
+	Systick_StopTimer();
+	Systick_Init(&Config);
+	Systick_SimulatedIcsr = 0U;
+	Test_Calls = 0U;
+	Test_LastContext = NULL_PTR;
+}
+
+static void Test_Configuration(void)
+{
+	Test_FuncCalls = 0U;
+	Systick_Init(&Systick_Configuration);
+	Systick_StartTimer(1);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.LOAD, 1000U);
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_FuncCalls, 1U);
+	Systick_StopTimer();
+}
+
+static void Test_Periodic(void)
+{
+	uint8 Context;
+
+	Test_Setup(SYSTICK_PERIODIC_INTERVAL);
+	Systick_StartTimerWithCallback(5, Test_Callback, &Context);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.LOAD, 5000U);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & (TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT),
+			TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT);
+	SysTick_Handler();
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 2U);
+	TEST_CHECK(Test_LastContext == &Context);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_SYSTICK_ENABLE, TEST_SYSTICK_ENABLE);
+}
+
+static void Test_SingleRetires(void)
+{
+	Test_Setup(SYSTICK_SINGLE_INTERVAL);
+	Systick_StartTimerWithCallback(1, Test_Callback, NULL_PTR);
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 1U);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & (TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT), 0U);
+	/* a late interrupt of the retired timer is not delivered */
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 1U);
+}
+
+static void Test_SingleRestartFromCallback(void)
+{
+	Test_Setup(SYSTICK_SINGLE_INTERVAL);
+	Systick_StartTimerWithCallback(1, Test_Restart, NULL_PTR);
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 1U);
+	/* the timer started by the callback keeps running */
+	TEST_CHECK_EQ(Systick_SimulatedSystick.LOAD, 2000U);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & (TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT),
+			TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT);
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 2U);
+}
+
+static void Test_StopDropsPending(void)
+{
+	Test_Setup(SYSTICK_PERIODIC_INTERVAL);
+	Systick_StartTimerWithCallback(1, Test_Callback, NULL_PTR);
+	Systick_SimulatedIcsr = 0U;
+	Systick_StopTimer();
+	TEST_CHECK_EQ(Systick_SimulatedIcsr, SCB_ICSR_PENDSTCLR);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & (TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT), 0U);
+	/* an interrupt already taken when the timer was stopped is not delivered */
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 0U);
+}
+
+static void Test_PeriodicToSingle(void)
+{
+	Test_Setup(SYSTICK_PERIODIC_INTERVAL);
+	Systick_StartTimerWithCallback(1, Test_Callback, NULL_PTR);
+	SysTick_Handler();
+	Systick_SetMode(SYSTICK_SINGLE_INTERVAL);
+	/* the running timer switches at its next interrupt */
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_SYSTICK_TICKINT, TEST_SYSTICK_TICKINT);
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 2U);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & (TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT), 0U);
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 2U);
+}
+
+static void Test_SingleToPeriodic(void)
+{
+	Test_Setup(SYSTICK_SINGLE_INTERVAL);
+	Systick_StartTimerWithCallback(1, Test_Callback, NULL_PTR);
+	Systick_SetMode(SYSTICK_PERIODIC_INTERVAL);
+	SysTick_Handler();
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 2U);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & (TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT),
+			TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT);
+}
+
+static void Test_ToBusyWaitHalts(void)
+{
+	Test_Setup(SYSTICK_PERIODIC_INTERVAL);
+	Systick_StartTimerWithCallback(1, Test_Callback, NULL_PTR);
+	Systick_SetMode(SYSTICK_BUSYWAIT);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & (TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT), 0U);
+	TEST_CHECK_EQ(Systick_SimulatedIcsr, SCB_ICSR_PENDSTCLR);
+	SysTick_Handler();
+	TEST_CHECK_EQ(Test_Calls, 0U);
+}
+
+static void Test_Errors(void)
+{
+	Test_Setup(SYSTICK_PERIODIC_INTERVAL);
+	Systick_SetMode((Systick_ModeType) 3);
+	TEST_CHECK_EQ(Test_DetCount, 1U);
+	TEST_CHECK_EQ(Test_DetError, SYSTICK_E_PARAM_MODE);
+	/* an interrupt driven timer needs a notification */
+	Systick_StartTimerWithCallback(1, NULL_PTR, NULL_PTR);
+	TEST_CHECK_EQ(Test_DetApi, SYSTICK_START_TIMER_CALLBACK_SID);
+	TEST_CHECK_EQ(Test_DetError, SYSTICK_E_PARAM_POINTER);
+	TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_SYSTICK_ENABLE, 0U);
+}
+
+/* Seeded interleaving stress: SysTick_Handler is taken at random interrupt points of the
+ * driver (where its critical sections unmask interrupts), the tests check after each
+ * interrupt and API call that the registers agree with the timer state */
+#define TEST_STRESS_SEEDS	(8U)
+#define TEST_STRESS_STEPS	(4000U)
+#define TEST_ARMED			(TEST_SYSTICK_ENABLE | TEST_SYSTICK_TICKINT)
+
+static uint32 Test_Seed;
+static boolean Test_InHandler;
+static boolean Test_ModeKnown;
+static Systick_ModeType Test_Mode;			/* mode SysTick_Handler runs with */
+static Systick_ModeType Test_NewMode;		/* mode passed to the running Systick_SetMode */
+static uint32 Test_SetModePoints;			/* interrupt points passed in Systick_SetMode */
+static boolean Test_InSetMode;
+static boolean Test_LastPointTook;			/* the last interrupt point took SysTick_Handler */
+static uint32 Test_Delivered;
+static uint8 Test_Action;					/* what the last notification did to the timer */
+
+#define TEST_ACTION_NONE		(0U)
+#define TEST_ACTION_RESTART		(1U)
+#define TEST_ACTION_STOP		(2U)
+
+static uint32 Test_Random(void)
+{
+	Test_Seed = (Test_Seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+	return (Test_Seed >> 16) & 0x7FFFU;
+}
+
+/* The timer is either running with its interrupt or fully stopped */
+static void Test_CheckCtrl(void)
+{
+	uint32 Ctrl = Systick_SimulatedSystick.CTRL & TEST_ARMED;
+
+	TEST_CHECK((Ctrl == 0U) || (Ctrl == TEST_ARMED));
+}
+
+/* Notification of the stress timers, sometimes restarting or stopping the timer */
+static void Test_StressCallback(void* Context)
+{
+	uint32 Choice = Test_Random() % 8U;
+
+	Test_Delivered++;
+	Test_Action = TEST_ACTION_NONE;
+	if (Choice == 0U)
+	{
+		Systick_StartTimerWithCallback(7, Test_StressCallback, Context);
+		Test_Action = TEST_ACTION_RESTART;
+	}
+	else if (Choice == 1U)
+	{
+		Systick_StopTimer();
+		Test_Action = TEST_ACTION_STOP;
+	}
+}
+
+/* Takes the SysTick interrupt: an armed timer delivers one notification and a stopped or
+ * retired one none, then a one-shot is retired and a periodic timer keeps running */
+static void Test_Take(void)
+{
+	uint32 Armed = Systick_SimulatedSystick.CTRL & TEST_SYSTICK_TICKINT;
+
+	Test_InHandler = TRUE;
+	Test_Delivered = 0U;
+	Test_Action = TEST_ACTION_NONE;
+	SysTick_Handler();
+	Test_InHandler = FALSE;
+	TEST_CHECK_EQ(Test_Delivered, (Armed != 0U) ? 1U : 0U);
+	if (Test_Action == TEST_ACTION_RESTART)
+	{
+		TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_ARMED, TEST_ARMED);
+		TEST_CHECK_EQ(Systick_SimulatedSystick.LOAD, 7000U);
+	}
+	else if (Test_Action == TEST_ACTION_STOP)
+	{
+		TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_ARMED, 0U);
+	}
+	else if ((Armed != 0U) && (Test_ModeKnown == TRUE))
+	{
+		TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_ARMED,
+				(Test_Mode == SYSTICK_PERIODIC_INTERVAL) ? TEST_ARMED : 0U);
+	}
+	Test_CheckCtrl();
+}
+
+/* Systick_SimulatedInterrupt of the stress test */
+static void Test_InterruptPoint(void)
+{
+	/* SysTick_Handler does not preempt itself */
+	if (Test_InHandler == TRUE)
+	{
+		return;
+	}
+	/* Systick_SetMode has one critical section: the mode changes between its two points */
+	if ((Test_InSetMode == TRUE) && (++Test_SetModePoints >= 2U))
+	{
+		Test_Mode = Test_NewMode;
+	}
+	Test_LastPointTook = FALSE;
+	if ((Test_Random() % 3U) == 0U)
+	{
+		Test_Take();
+		Test_LastPointTook = TRUE;
+	}
+}
+
+static void Test_StressSetMode(Systick_ModeType Mode)
+{
+	Test_NewMode = Mode;
+	Test_SetModePoints = 0U;
+	Test_InSetMode = TRUE;
+	Systick_SetMode(Mode);
+	Test_InSetMode = FALSE;
+	Test_Mode = Mode;
+	if (Mode == SYSTICK_BUSYWAIT)
+	{
+		TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_ARMED, 0U);
+	}
+}
+
+static void Test_StressStep(void)
+{
+	uint32 Value;
+
+	Test_LastPointTook = FALSE;
+	switch (Test_Random() % 4U)
+	{
+		case 0U:
+			if (Test_Mode == SYSTICK_BUSYWAIT)
+			{
+				/* a busy-wait start would spin on the simulated COUNTFLAG */
+				Test_StressSetMode(SYSTICK_PERIODIC_INTERVAL);
+				break;
+			}
+			Value = 1U + (Test_Random() % 5U);
+			Systick_StartTimerWithCallback(Value, Test_StressCallback, NULL_PTR);
+			/* unless an interrupt was taken after the start, the new timer is running */
+			if (Test_LastPointTook == FALSE)
+			{
+				TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_ARMED, TEST_ARMED);
+				TEST_CHECK_EQ(Systick_SimulatedSystick.LOAD, Value * 1000U);
+			}
+			break;
+		case 1U:
+			Systick_StopTimer();
+			TEST_CHECK_EQ(Systick_SimulatedSystick.CTRL & TEST_ARMED, 0U);
+			break;
+		case 2U:
+			Test_StressSetMode((Systick_ModeType) (Test_Random() % 3U));
+			break;
+		default:
+			Test_Take();
+			break;
+	}
+	Test_CheckCtrl();
+}
+
+static void Test_Stress(void)
+{
+	uint32 Seed;
+	uint32 Step;
+	uint32 Failures;
+
+	for (Seed = 1U; Seed <= TEST_STRESS_SEEDS; Seed++)
+	{
+		Failures = Test_Failures;
+		Test_Setup(SYSTICK_PERIODIC_INTERVAL);
+		Test_Seed = Seed;
+		Test_Mode = SYSTICK_PERIODIC_INTERVAL;
+		Test_ModeKnown = TRUE;
+		Systick_SimulatedInterrupt = Test_InterruptPoint;
+		for (Step = 0U; (Step < TEST_STRESS_STEPS) && (Test_Failures == Failures); Step++)
+		{
+			Test_StressStep();
+		}
+		Systick_SimulatedInterrupt = NULL_PTR;
+		if (Test_Failures != Failures)
+		{
+			printf("test_systick.c: stress seed %lu failed after %lu steps\n",
+					(unsigned long) Seed, (unsigned long) Step);
+		}
+	}
+	TEST_CHECK_EQ(Systick_SimulatedPrimask, 0U);
+	Systick_StopTimer();
+}
+
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+static void Test_Jitter(void)
+{
+	Systick_JitterStatsType Stats;
+
+	Test_Setup(SYSTICK_PERIODIC_INTERVAL);
+	Systick_ResetJitterStats();
+	Systick_StartTimerWithCallback(5, Test_Elapse, NULL_PTR);
+	/* taken 10 ticks after the reload, the callback runs for 90 ticks */
+	Systick_SimulatedSystick.VAL = 4990U;
+	Test_ExitValue = 4900U;
+	SysTick_Handler();
+	Systick_GetJitterStats(&Stats);
+	TEST_CHECK_EQ(Stats.Count, 1U);
+	TEST_CHECK_EQ(Stats.LastLatency, 10U);
+	TEST_CHECK_EQ(Stats.LastCallbackDuration, 90U);
+	TEST_CHECK_EQ(Stats.LatencyHistogram[10U / SYSTICK_JITTER_BIN_WIDTH], 1U);
+	/* a latency beyond the histogram lands in the last bin */
+	Systick_SimulatedSystick.VAL = 4800U;
+	Test_ExitValue = 4790U;
+	SysTick_Handler();
+	Systick_GetJitterStats(&Stats);
+	TEST_CHECK_EQ(Stats.Count, 2U);
+	TEST_CHECK_EQ(Stats.LastLatency, 200U);
+	TEST_CHECK_EQ(Stats.MaxLatency, 200U);
+	TEST_CHECK_EQ(Stats.LastCallbackDuration, 10U);
+	TEST_CHECK_EQ(Stats.MaxCallbackDuration, 90U);
+	TEST_CHECK_EQ(Stats.LatencyHistogram[SYSTICK_JITTER_HIST_BINS - 1U], 1U);
+	Systick_ResetJitterStats();
+	Systick_GetJitterStats(&Stats);
+	TEST_CHECK_EQ(Stats.Count, 0U);
+	TEST_CHECK_EQ(Stats.MaxLatency, 0U);
+	TEST_CHECK_EQ(Stats.LatencyHistogram[SYSTICK_JITTER_HIST_BINS - 1U], 0U);
+}
+
+static void Test_JitterRestart(void)
+{
+	Systick_JitterStatsType Stats;
+
+	Test_Setup(SYSTICK_PERIODIC_INTERVAL);
+	Systick_ResetJitterStats();
+	Systick_StartTimerWithCallback(5, Test_ElapseRestart, NULL_PTR);
+	/* the latency is measured against the 5000 tick period the interrupt was taken with */
+	Systick_SimulatedSystick.VAL = 4980U;
+	SysTick_Handler();
+	TEST_CHECK_EQ(Systick_SimulatedSystick.LOAD, 2000U);
+	Systick_GetJitterStats(&Stats);
+	TEST_CHECK_EQ(Stats.Count, 1U);
+	TEST_CHECK_EQ(Stats.LastLatency, 20U);
+	/* the counter was restarted by the callback, no duration is recorded */
+	TEST_CHECK_EQ(Stats.LastCallbackDuration, 0U);
+	TEST_CHECK_EQ(Stats.MaxCallbackDuration, 0U);
+	Systick_GetJitterStats(NULL_PTR);
+	TEST_CHECK_EQ(Test_DetApi, SYSTICK_GET_JITTER_STATS_SID);
+	TEST_CHECK_EQ(Test_DetError, SYSTICK_E_PARAM_POINTER);
+	Systick_StopTimer();
+}
+#endif
+
+int main(void)
+{
+	TEST_RUN(Test_Configuration);
+	TEST_RUN(Test_Periodic);
+	TEST_RUN(Test_SingleRetires);
+	TEST_RUN(Test_SingleRestartFromCallback);
+	TEST_RUN(Test_StopDropsPending);
+	TEST_RUN(Test_PeriodicToSingle);
+	TEST_RUN(Test_SingleToPeriodic);
+	TEST_RUN(Test_ToBusyWaitHalts);
+	TEST_RUN(Test_Errors);
+	TEST_RUN(Test_Stress);
+#if (SYSTICK_JITTER_MEASUREMENT == STD_ON)
+	TEST_RUN(Test_Jitter);
+	TEST_RUN(Test_JitterRestart);
+#endif
+	return TEST_END();
+}
@@ -0,0 +1,30 @@
+/**
+ *@file       uart_stub.c
+ *@brief      Host test support
+ *@details    USART_TransmitString of the host tests, the strings are kept in Test_UartBuffer.
+ */
+#include <string.h>
+#include "Uart.h"
+#include "test.h"
+
+char Test_UartBuffer[TEST_UART_BUFFER_SIZE + 1U];
+uint32 Test_UartLength;
+
+void USART_TransmitString(USART_ID UART_ID, uint8 *string_Copy_U8Data,
+		uint32 Copy_U8Length, uint32 Copy_U32TimeOut)
+{
+	(void) UART_ID;
+	(void) Copy_U32TimeOut;
+	if ((Test_UartLength + Copy_U8Length) <= TEST_UART_BUFFER_SIZE)
+	{
+		memcpy(&Test_UartBuffer[Test_UartLength], string_Copy_U8Data, Copy_U8Length);
+		Test_UartLength += Copy_U8Length;
+		Test_UartBuffer[Test_UartLength] = '\0';
+	}
+}
+
+void Test_UartClear(void)
+{
+	Test_UartLength = 0U;
+	Test_UartBuffer[0] = '\0';
+}
@@ -41,6 +41,10 @@
 #include "Dio.h"
 #include "Port.h"
 
+/* the probes of this file follow UART_PROFILING */
+#define PROF_MODULE_PROFILING	UART_PROFILING
+#include "Prof.h"
+
 /*
  DIV BY 16
  ENABLE USART
@@ -161,24 +165,24 @@ void USART_VidInit(const USART_ConfigType *USART_CFG) {
 				switch (UART_PTR->UART_Array[i].USARTid) 
                 {
 				case UART1:
-					Port_SetPinDirection(A9, PORT_PIN_OUT_2MHz);
-					Port_SetPinDirection(A10, PORT_PIN_IN);
-					Port_SetPinMode(A9, AF_OPP);
-					Port_SetPinMode(A10, FLOATING_INPUT);
+					Port_SetPinDirection(UART1_TX_PIN, UART1_TX_DIRECTION);
+					Port_SetPinDirection(UART1_RX_PIN, UART1_RX_DIRECTION);
+					Port_SetPinMode(UART1_TX_PIN, UART1_TX_MODE);
+					Port_SetPinMode(UART1_RX_PIN, UART1_RX_MODE);
 					UART_NUM = MUART1;
 					break;
 				case UART2:
-					Port_SetPinDirection(A2, PORT_PIN_OUT_2MHz);
-					Port_SetPinDirection(A3, PORT_PIN_IN);
-					Port_SetPinMode(A2, AF_OPP);
-					Port_SetPinMode(A3, FLOATING_INPUT);
+					Port_SetPinDirection(UART2_TX_PIN, UART2_TX_DIRECTION);
+					Port_SetPinDirection(UART2_RX_PIN, UART2_RX_DIRECTION);
+					Port_SetPinMode(UART2_TX_PIN, UART2_TX_MODE);
+					Port_SetPinMode(UART2_RX_PIN, UART2_RX_MODE);
 					UART_NUM = MUART2;
 					break;
 				case UART3:
-					Port_SetPinDirection(B10, PORT_PIN_OUT_2MHz);
-					Port_SetPinDirection(B11, PORT_PIN_IN);
-					Port_SetPinMode(B10, AF_OPP);
-					Port_SetPinMode(B11, FLOATING_INPUT);
+					Port_SetPinDirection(UART3_TX_PIN, UART3_TX_DIRECTION);
+					Port_SetPinDirection(UART3_RX_PIN, UART3_RX_DIRECTION);
+					Port_SetPinMode(UART3_TX_PIN, UART3_TX_MODE);
+					Port_SetPinMode(UART3_RX_PIN, UART3_RX_MODE);
 					UART_NUM = MUART3;
 					break;
 				}
@@ -520,6 +524,7 @@ void USART_TransmitString(USART_ID UART_ID, uint8 *string_Copy_uint8Data,
 		uint32 Copy_uint8Length, uint32 Copy_U32TimeOut) {
     // Variable to track timeout threshold
 	uint32 THRESHOLD_VALUE = 0;
+	PROF_START(PROF_PROBE_UART_TRANSMIT);
 	for (int i = 0; i < Copy_uint8Length; i++)
      {
         /* Send each character via USART*/
@@ -536,6 +541,7 @@ void USART_TransmitString(USART_ID UART_ID, uint8 *string_Copy_uint8Data,
 			THRESHOLD_VALUE = 0;
 		}
 	}
+	PROF_STOP(PROF_PROBE_UART_TRANSMIT);
 }
 
 /***********************************[5]***********************************************
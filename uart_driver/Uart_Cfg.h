@@ -39,5 +39,28 @@
 #define NUMBER_OF_USED_UARTS 	3
 #define F_CPU              8000000
 #define MAX_STRING_TO_BE_RECEIVED_USART 100
+/* measure USART_TransmitString with the PROF_PROBE_UART_TRANSMIT probe (needs prof_driver) */
+#define UART_PROFILING     STD_OFF
+
+/* Port pins of each USART (no remap) with the mode and direction USART_VidInit gives them,
+ * the pins claimed in the Port pin table are checked against them in port_PBCfg.c */
+#define UART1_TX_PIN           PA9
+#define UART1_TX_MODE          AF_OPP
+#define UART1_TX_DIRECTION     PORT_PIN_OUT_2MHz
+#define UART1_RX_PIN           PA10
+#define UART1_RX_MODE          FLOATING_INPUT
+#define UART1_RX_DIRECTION     PORT_PIN_IN
+#define UART2_TX_PIN           PA2
+#define UART2_TX_MODE          AF_OPP
+#define UART2_TX_DIRECTION     PORT_PIN_OUT_2MHz
+#define UART2_RX_PIN           PA3
+#define UART2_RX_MODE          FLOATING_INPUT
+#define UART2_RX_DIRECTION     PORT_PIN_IN
+#define UART3_TX_PIN           PB10
+#define UART3_TX_MODE          AF_OPP
+#define UART3_TX_DIRECTION     PORT_PIN_OUT_2MHz
+#define UART3_RX_PIN           PB11
+#define UART3_RX_MODE          FLOATING_INPUT
+#define UART3_RX_DIRECTION     PORT_PIN_IN
 
 #endif